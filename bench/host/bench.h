@@ -0,0 +1,41 @@
+/* A small benchmark harness in the spirit of Google Benchmark.
+ *
+ * A benchmark is a function taking a struct bench_state that runs the code
+ * under test state->iterations times. The harness picks the iteration count
+ * so that each measurement takes long enough to be stable and reports the
+ * time per iteration. BENCHMARK() registers a function once per argument;
+ * the argument describes the input (board fill, snake length, ...) and is
+ * available as state->arg.
+ */
+
+#ifndef BENCH_HOST_BENCH_H
+#define BENCH_HOST_BENCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct bench_state {
+	long arg;
+	uint64_t iterations;
+};
+
+typedef void (*bench_fn)(struct bench_state *);
+
+void bench_register(const char *name, bench_fn fn, const long *args,
+	size_t nargs);
+
+/* Keeps the compiler from discarding a result the benchmark never uses. */
+#define bench_keep(value) __asm__ volatile("" : : "g"(value) : "memory")
+
+/* Keeps the compiler from assuming memory is unchanged between iterations. */
+#define bench_clobber() __asm__ volatile("" : : : "memory")
+
+#define BENCHMARK(fn, ...) \
+	static const long fn##_args[] = { __VA_ARGS__ }; \
+	__attribute__((constructor)) static void fn##_register(void) \
+	{ \
+		bench_register(#fn, fn, fn##_args, \
+			sizeof fn##_args / sizeof fn##_args[0]); \
+	}
+
+#endif // BENCH_HOST_BENCH_H
@@ -0,0 +1,92 @@
+/* 2048 kernels: shl_combine, slide_row and rot90. The argument is the number
+ * of occupied tiles on the boards, so 16 is a full board late in a game.
+ */
+
+#include "../../src/game2048_app.c"
+
+#include <stdlib.h>
+
+#include "bench.h"
+
+#define N_BOARDS 64
+
+static uint24_t boards[N_BOARDS][_2048_GRID_WH][_2048_GRID_WH];
+
+/* The game allocates its state when it starts, the benchmarks share one
+ * allocation.
+ */
+static void alloc_state(void)
+{
+	if (!bss)
+		bss = arena_alloc(&arena, sizeof *bss);
+}
+
+/* Fills N_BOARDS boards with filled tiles each. The values are kept small
+ * and close together, as they are in a real game, so that merges happen.
+ */
+static void make_boards(long filled)
+{
+	alloc_state();
+	srandom(filled);
+	memset(boards, 0, sizeof boards);
+	for (int b = 0; b < N_BOARDS; ++b) {
+		uint24_t *cells = (uint24_t *) boards[b];
+		for (long n = 0; n < filled; ) {
+			int pos = random() % (_2048_GRID_WH * _2048_GRID_WH);
+			if (cells[pos])
+				continue;
+			cells[pos] = 2u << (random() % 6);
+			++n;
+		}
+	}
+}
+
+static void BM_shl_combine(struct bench_state *state)
+{
+	make_boards(state->arg);
+	for (uint64_t i = 0; i < state->iterations; ++i) {
+		memcpy(tiles, boards[i % N_BOARDS], sizeof tiles);
+		bench_keep(shl_combine());
+	}
+}
+BENCHMARK(BM_shl_combine, 4, 8, 12, 15, 16)
+
+static void BM_slide_row(struct bench_state *state)
+{
+	make_boards(state->arg);
+	uint24_t *rows = (uint24_t *) boards;
+	uint24_t row[_2048_GRID_WH];
+	for (uint64_t i = 0; i < state->iterations; ++i) {
+		size_t r = i % (N_BOARDS * _2048_GRID_WH);
+		memcpy(row, &rows[r * _2048_GRID_WH], sizeof row);
+		bench_keep(slide_row(row));
+		bench_clobber();
+	}
+}
+BENCHMARK(BM_slide_row, 4, 8, 12, 15, 16)
+
+static void BM_rot90(struct bench_state *state)
+{
+	make_boards(state->arg);
+	memcpy(tiles, boards[0], sizeof tiles);
+	for (uint64_t i = 0; i < state->iterations; ++i) {
+		rot90();
+		bench_clobber();
+	}
+}
+BENCHMARK(BM_rot90, 16)
+
+/* A whole up move as the main loop performs it. */
+static void BM_move_up(struct bench_state *state)
+{
+	make_boards(state->arg);
+	for (uint64_t i = 0; i < state->iterations; ++i) {
+		memcpy(tiles, boards[i % N_BOARDS], sizeof tiles);
+		rot90();
+		rot90();
+		rot90();
+		bench_keep(shl_combine());
+		rot90();
+	}
+}
+BENCHMARK(BM_move_up, 8, 15)
@@ -0,0 +1,47 @@
+/* any() and all() from common.c. The argument is the buffer size in bytes;
+ * the buffers are all zero for any() and all non-zero for all(), which are
+ * the cases that scan the whole buffer.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "../../src/common.h"
+#include "bench.h"
+
+static uint8_t buffer[1024];
+
+static void BM_any(struct bench_state *state)
+{
+	memset(buffer, 0, sizeof buffer);
+	for (uint64_t i = 0; i < state->iterations; ++i) {
+		bench_keep(any(buffer, state->arg, 1));
+		bench_clobber();
+	}
+}
+BENCHMARK(BM_any, 16, 81, 810)
+
+/* all() over uint24_t elements, as spawn_new() calls it on the 2048 board */
+static void BM_all(struct bench_state *state)
+{
+	memset(buffer, 1, sizeof buffer);
+	for (uint64_t i = 0; i < state->iterations; ++i) {
+		bench_keep(all(buffer, state->arg / sizeof(uint24_t),
+			sizeof(uint24_t)));
+		bench_clobber();
+	}
+}
+BENCHMARK(BM_all, 48, 243)
+
+/* rng_below() with the bounds the games draw from: the 2048 cells and the
+ * snake grid. 24 is the one that has the most draws rejected.
+ */
+static void BM_rng_below(struct bench_state *state)
+{
+	struct Rng rng = { 1 };
+	for (uint64_t i = 0; i < state->iterations; ++i) {
+		bench_keep(rng_below(&rng, state->arg));
+		bench_clobber();
+	}
+}
+BENCHMARK(BM_rng_below, 16, 24, 32)
@@ -0,0 +1,45 @@
+/* Decoding a level with each codec of enum LevelCodec, through
+ * levelpack_cells() as the game does. The levels are taken from the built-in
+ * pack and encoded by tools/sokpack's encoders, whose -s reports what each
+ * codec does to the size of the pack. The argument is the level number.
+ */
+
+#define main sokpack_main
+#include "../../tools/sokpack.c"
+#undef main
+
+#include "../../src/arena.h"
+#include "bench.h"
+
+static void decode(struct bench_state *state, enum LevelCodec codec)
+{
+	static struct LevelPack *pack;
+	static uint8_t block[BLOCK_HEADER_SIZE + 2 * MAX_CELLS + 16];
+	static uint8_t buf[MAX_CELLS];
+	struct LevelBlock *b = (struct LevelBlock *) block;
+
+	if (!pack)
+		pack = levelpack_open(&arena, LEVELPACK_BUILTIN);
+	const struct LevelBlock *level = levelpack_level(pack, state->arg);
+	size_t n = level->w * level->h;
+	*b = *level;
+	b->codec = codec;
+	codecs[codec].encode(levelpack_cells(level, buf), n, b->data);
+
+	for (uint64_t i = 0; i < state->iterations; ++i) {
+		bench_keep(levelpack_cells(b, buf));
+		bench_clobber();
+	}
+}
+
+#define BENCHMARK_CODEC(name, codec) \
+	static void BM_decode_##name(struct bench_state *state) \
+	{ \
+		decode(state, codec); \
+	} \
+	BENCHMARK(BM_decode_##name, 0, 19, 39)
+
+BENCHMARK_CODEC(zx7, LEVEL_CODEC_ZX7)
+BENCHMARK_CODEC(zx0, LEVEL_CODEC_ZX0)
+BENCHMARK_CODEC(lz4, LEVEL_CODEC_LZ4)
+BENCHMARK_CODEC(rle, LEVEL_CODEC_RLE)
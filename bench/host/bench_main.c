@@ -0,0 +1,141 @@
+/* Runs the benchmarks registered with BENCHMARK() and reports the time per
+ * operation. With --json the results are also written in Google Benchmark's
+ * JSON layout so that they can be kept and compared over time.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "bench.h"
+
+#define MAX_BENCHMARKS 128
+#define MIN_TIME_NS 200000000.0
+#define REPETITIONS 3
+
+struct benchmark {
+	char name[64];
+	bench_fn fn;
+	long arg;
+	double ns_per_op;
+	uint64_t iterations;
+};
+
+static struct benchmark benchmarks[MAX_BENCHMARKS];
+static size_t n_benchmarks;
+
+void bench_register(const char *name, bench_fn fn, const long *args,
+	size_t nargs)
+{
+	for (size_t i = 0; i < nargs; ++i) {
+		if (n_benchmarks == MAX_BENCHMARKS) {
+			fprintf(stderr, "too many benchmarks\n");
+			exit(EXIT_FAILURE);
+		}
+		struct benchmark *b = &benchmarks[n_benchmarks++];
+		snprintf(b->name, sizeof b->name, "%s/%ld", name, args[i]);
+		b->fn = fn;
+		b->arg = args[i];
+	}
+}
+
+static double now_ns(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static double time_run(struct benchmark *b, uint64_t iterations)
+{
+	struct bench_state state = { b->arg, iterations };
+	double start = now_ns();
+	b->fn(&state);
+	return now_ns() - start;
+}
+
+/* Grows the iteration count until a run takes at least MIN_TIME_NS, then
+ * keeps the fastest of REPETITIONS runs of that size.
+ */
+static void run(struct benchmark *b)
+{
+	uint64_t iterations = 1;
+	double elapsed;
+
+	while ((elapsed = time_run(b, iterations)) < MIN_TIME_NS) {
+		double scale = (elapsed > 0) ? MIN_TIME_NS / elapsed * 1.2 : 10;
+		if (scale > 10)
+			scale = 10;
+		iterations = iterations * scale + 1;
+	}
+
+	double best = elapsed;
+	for (int i = 1; i < REPETITIONS; ++i) {
+		elapsed = time_run(b, iterations);
+		if (elapsed < best)
+			best = elapsed;
+	}
+
+	b->iterations = iterations;
+	b->ns_per_op = best / iterations;
+}
+
+static void write_json(const char *path)
+{
+	FILE *f = fopen(path, "w");
+	if (!f) {
+		perror(path);
+		exit(EXIT_FAILURE);
+	}
+
+	char date[32];
+	time_t t = time(NULL);
+	strftime(date, sizeof date, "%Y-%m-%dT%H:%M:%S", localtime(&t));
+
+	fprintf(f, "{\n  \"context\": {\n    \"date\": \"%s\"\n  },\n", date);
+	fprintf(f, "  \"benchmarks\": [\n");
+	for (size_t i = 0, n = 0; i < n_benchmarks; ++i) {
+		struct benchmark *b = &benchmarks[i];
+		if (!b->iterations)
+			continue;
+		fprintf(f, "%s    {\"name\": \"%s\", \"iterations\": %llu, "
+			"\"real_time\": %.2f, \"time_unit\": \"ns\"}",
+			n++ ? ",\n" : "", b->name,
+			(unsigned long long) b->iterations, b->ns_per_op);
+	}
+	fprintf(f, "\n  ]\n}\n");
+	fclose(f);
+}
+
+int main(int argc, char *argv[])
+{
+	const char *filter = NULL, *json = NULL;
+
+	for (int i = 1; i < argc; ++i) {
+		if (!strcmp(argv[i], "--json") && i + 1 < argc) {
+			json = argv[++i];
+		} else if (!strcmp(argv[i], "--filter") && i + 1 < argc) {
+			filter = argv[++i];
+		} else {
+			fprintf(stderr, "usage: %s [--filter SUBSTRING] "
+				"[--json FILE]\n", argv[0]);
+			return EXIT_FAILURE;
+		}
+	}
+
+	printf("%-40s %12s %12s\n", "benchmark", "ns/op", "iterations");
+	for (size_t i = 0; i < n_benchmarks; ++i) {
+		struct benchmark *b = &benchmarks[i];
+		if (filter && !strstr(b->name, filter))
+			continue;
+		run(b);
+		printf("%-40s %12.1f %12llu\n", b->name, b->ns_per_op,
+			(unsigned long long) b->iterations);
+		fflush(stdout);
+	}
+
+	if (json)
+		write_json(json);
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,88 @@
+/* Snake kernels: collcheck, move_tail and iteredges. The argument is the
+ * number of segments (edges between vertices) in the snake.
+ */
+
+#include "../../src/snake_app.c"
+
+#include "bench.h"
+
+/* The game allocates its state when it starts, the benchmarks share one
+ * allocation.
+ */
+static void alloc_state(void)
+{
+	if (!bss)
+		bss = arena_alloc(&arena, sizeof *bss);
+}
+
+/* Lays out a snake with the given number of segments, each one cell long,
+ * as a zigzag across two rows that folds back at the edges of the grid.
+ * This is the worst case for the vertex list since every cell is a turn.
+ */
+static struct Snake make_snake(long segments)
+{
+	struct Pos p = { 0, 1 };
+	int dx = 1, phase = 0;
+
+	alloc_state();
+	vertdata[0] = p;
+	for (long i = 1; i <= segments; ++i) {
+		if ((dx > 0 && p.x == SNAKE_GRID_WIDTH - 1) ||
+			(dx < 0 && p.x == 0)) {
+			// Fold back two rows lower.
+			p.y += 2;
+			dx = -dx;
+			phase = 0;
+		} else if (phase % 2 == 0) {
+			p.x += dx;
+			++phase;
+		} else {
+			// Step between the two rows of the current band.
+			p.y += (phase % 4 == 1) ? -1 : 1;
+			++phase;
+		}
+		vertdata[i] = p;
+	}
+
+	struct Snake snake = { &vertdata[0], &vertdata[segments] };
+	return snake;
+}
+
+/* The food is never on the snake, so every edge is visited. */
+static void BM_collcheck(struct bench_state *state)
+{
+	struct Snake snake = make_snake(state->arg);
+	struct Pos food = { SNAKE_GRID_WIDTH - 1, SNAKE_GRID_HEIGHT - 1 };
+	for (uint64_t i = 0; i < state->iterations; ++i) {
+		bench_keep(collcheck(snake, food));
+		bench_clobber();
+	}
+}
+BENCHMARK(BM_collcheck, 16, 100, 600)
+
+static void BM_move_tail(struct bench_state *state)
+{
+	struct Snake start = make_snake(state->arg);
+	struct Pos tail = *start.tail;
+	for (uint64_t i = 0; i < state->iterations; ++i) {
+		struct Snake snake = start;
+		*snake.tail = tail;
+		move_tail(&snake);
+		bench_keep(snake.tail);
+		bench_clobber();
+	}
+}
+BENCHMARK(BM_move_tail, 16, 600)
+
+/* The traversal draw_snake() performs, without the drawing. */
+static void BM_iteredges(struct bench_state *state)
+{
+	struct Snake snake = make_snake(state->arg);
+	struct Pos p1, p2;
+	for (uint64_t i = 0; i < state->iterations; ++i) {
+		iteredges(snake, NULL, NULL);
+		while (iteredges(snake, &p1, &p2))
+			bench_keep(p1.x + p2.y);
+	}
+}
+BENCHMARK(BM_iteredges, 16, 100, 600)
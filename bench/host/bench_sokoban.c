@@ -0,0 +1,109 @@
+/* Sokoban kernels: load_level, find_live, check_level_complete,
+ * player_reach, find_path and the level select's thumbnails. The argument
+ * is the level number.
+ */
+
+#include "../../src/sokoban_app.c"
+
+#include "bench.h"
+
+/* The game allocates its state when it starts, the benchmarks share one
+ * allocation.
+ */
+static void alloc_state(void)
+{
+	if (!bss) {
+		bss = arena_alloc(&arena, sizeof *bss);
+		pack_mark = arena_mark(&arena);
+		scratch_claim();
+		cells = arena_alloc(&scratch, LEVEL_GRID_SIZE);
+		queue = arena_alloc(&scratch, LEVEL_MAX_CELLS * sizeof *queue);
+		open_pack(PACK_BUILTIN);
+	}
+}
+
+static void BM_load_level(struct bench_state *state)
+{
+	alloc_state();
+	for (uint64_t i = 0; i < state->iterations; ++i) {
+		load_level(state->arg);
+		bench_clobber();
+	}
+}
+BENCHMARK(BM_load_level, 0, 19, 39)
+
+/* The dead square analysis, which load_level also counts. */
+static void BM_find_live(struct bench_state *state)
+{
+	alloc_state();
+	load_level(state->arg);
+	for (uint64_t i = 0; i < state->iterations; ++i) {
+		find_live();
+		bench_clobber();
+	}
+}
+BENCHMARK(BM_find_live, 0, 19, 39)
+
+/* Checked on the solved level, the only case where every row is read. */
+static void BM_check_level_complete(struct bench_state *state)
+{
+	alloc_state();
+	load_level(state->arg);
+	memcpy(boxes, goals, sizeof boxes);
+
+	for (uint64_t i = 0; i < state->iterations; ++i) {
+		bench_keep(check_level_complete());
+		bench_clobber();
+	}
+}
+BENCHMARK(BM_check_level_complete, 0, 19, 39)
+
+/* Where the player can walk from the start of the level. */
+static void BM_player_reach(struct bench_state *state)
+{
+	uint32_t reach[LEVEL_ROWS];
+
+	alloc_state();
+	load_level(state->arg);
+	for (uint64_t i = 0; i < state->iterations; ++i) {
+		player_reach(reach, playerx, playery);
+		bench_keep(reach[playery]);
+		bench_clobber();
+	}
+}
+BENCHMARK(BM_player_reach, 0, 19, 39)
+
+/* A walk from the start of the level to the last cell in it the player can
+ * get to, which the search looks through most of the level for.
+ */
+static void BM_find_path(struct bench_state *state)
+{
+	uint32_t reach[LEVEL_ROWS];
+	uint8_t x = 0, y = 0;
+
+	alloc_state();
+	load_level(state->arg);
+	player_reach(reach, playerx, playery);
+	for (uint8_t i = 0; i < height; ++i) {
+		if (reach[i]) {
+			y = i;
+			x = 31 - __builtin_clz(reach[i]);
+		}
+	}
+	for (uint64_t i = 0; i < state->iterations; ++i) {
+		bench_keep(find_path(x, y));
+		bench_clobber();
+	}
+}
+BENCHMARK(BM_find_path, 0, 19, 39)
+
+/* A thumbnail of the level select, from the packed level to pixels. */
+static void BM_draw_thumbnail(struct bench_state *state)
+{
+	alloc_state();
+	for (uint64_t i = 0; i < state->iterations; ++i) {
+		draw_thumbnail(state->arg, 0);
+		bench_clobber();
+	}
+}
+BENCHMARK(BM_draw_thumbnail, 0, 19, 39)
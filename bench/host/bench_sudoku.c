@@ -0,0 +1,76 @@
+/* Sudoku kernels: validate_num_insert_at_cur and update_candidate_set. The
+ * argument is the number of filled cells, so 17 is the sparsest grid a
+ * proper puzzle can have and 81 is a solved board.
+ */
+
+#include "../../src/sudoku_app.c"
+
+#include <stdlib.h>
+
+#include "bench.h"
+
+// The solution of the first board in sudoku_data.c
+static const uint8_t solution[SUDOKU_GRID_WH][SUDOKU_GRID_WH] = {
+	{ 3, 8, 2, 5, 1, 6, 7, 9, 4 },
+	{ 1, 4, 6, 7, 2, 9, 5, 8, 3 },
+	{ 5, 9, 7, 8, 4, 3, 6, 2, 1 },
+	{ 8, 1, 4, 6, 7, 5, 9, 3, 2 },
+	{ 9, 7, 5, 1, 3, 2, 4, 6, 8 },
+	{ 6, 2, 3, 9, 8, 4, 1, 5, 7 },
+	{ 7, 5, 1, 3, 9, 8, 2, 4, 6 },
+	{ 2, 6, 8, 4, 5, 1, 3, 7, 9 },
+	{ 4, 3, 9, 2, 6, 7, 8, 1, 5 },
+};
+
+static uint8_t initial[SUDOKU_GRID_WH * SUDOKU_GRID_WH];
+
+/* The game allocates its state when it starts, the benchmarks share one
+ * allocation.
+ */
+static void alloc_state(void)
+{
+	if (!bss)
+		bss = arena_alloc(&arena, sizeof *bss);
+}
+
+/* Keeps filled cells of the solution and makes them the given numbers. */
+static void make_grid(long filled)
+{
+	alloc_state();
+	memcpy(initial, solution, sizeof initial);
+	srandom(filled);
+	for (long empty = 81 - filled; empty > 0; ) {
+		int pos = random() % (SUDOKU_GRID_WH * SUDOKU_GRID_WH);
+		if (initial[pos]) {
+			initial[pos] = 0;
+			--empty;
+		}
+	}
+	tiles_initial = initial;
+	memcpy(tiles, initial, sizeof tiles);
+}
+
+/* One validation per cell and number, which is what the candidate set
+ * costs, but without the writes.
+ */
+static void BM_validate_num_insert_at_cur(struct bench_state *state)
+{
+	make_grid(state->arg);
+	for (uint64_t i = 0; i < state->iterations; ++i) {
+		curx = i % SUDOKU_GRID_WH;
+		cury = i / SUDOKU_GRID_WH % SUDOKU_GRID_WH;
+		bench_keep(validate_num_insert_at_cur(1 + i % 9));
+		bench_clobber();
+	}
+}
+BENCHMARK(BM_validate_num_insert_at_cur, 17, 30, 60)
+
+static void BM_update_candidate_set(struct bench_state *state)
+{
+	make_grid(state->arg);
+	for (uint64_t i = 0; i < state->iterations; ++i) {
+		update_candidate_set();
+		bench_clobber();
+	}
+}
+BENCHMARK(BM_update_candidate_set, 17, 30, 60)
@@ -0,0 +1,676 @@
+/* A host implementation of the graphx calls the games make, with overdraw
+ * accounting.
+ *
+ * Drawing works as on the calculator: there is a visible screen and an
+ * off-screen buffer, both 320x240 with one palette index per pixel, and
+ * gfx_SwapDraw() exchanges them. Every pixel written is counted against the
+ * call site that wrote it, together with whether the write actually changed
+ * the pixel compared to the frame on screen at the time. At each swap the
+ * frame's totals are recorded and, if asked for, the frame is written out as
+ * a PPM image or compared against a stored one.
+ */
+
+#define HOST_GRAPHX_IMPL
+#include <graphx.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "host.h"
+
+#define W GFX_LCD_WIDTH
+#define H GFX_LCD_HEIGHT
+
+#define MAX_SITES 256
+#define MAX_FRAMES 8192
+#define CHAR_WIDTH 8
+
+struct site {
+	const char *file, *func;
+	int line;
+	unsigned long calls, writes, changed;
+};
+
+struct frame {
+	unsigned long writes, touched, changed;
+};
+
+static uint8_t vram[2][H][W];
+static int screen;
+static int draw_target = gfx_screen;
+
+uint16_t host_gfx_palette[256];
+static uint8_t color, text_fg, text_bg, text_transparent, transparent;
+static int text_x, text_y;
+static bool text_clip;
+
+/* The clip region as graphx has it: xmax and ymax are exclusive. The NoClip
+ * calls and gfx_FillScreen() ignore it, and so does text unless it was
+ * configured with gfx_text_clip.
+ */
+static int clip_xmin, clip_ymin, clip_xmax = W, clip_ymax = H;
+static bool clipped = true;
+
+static struct site sites[MAX_SITES];
+static size_t n_sites;
+static struct site *cur_site;
+
+static struct frame frames[MAX_FRAMES];
+static size_t n_frames;
+static struct frame cur_frame;
+static uint8_t touched[H][W];
+
+static const char *ppm_dir, *golden_dir;
+static unsigned long golden_mismatches;
+
+/* An 8x8 stand-in for graphx's default font, covering ' ' to '~'. */
+static const uint8_t font[95][8] = {
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // ' '
+	{ 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x20, 0x00 }, // '!'
+	{ 0x50, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // '"'
+	{ 0x50, 0xF8, 0x50, 0x50, 0xF8, 0x50, 0x00, 0x00 }, // '#'
+	{ 0x20, 0x78, 0xA0, 0x70, 0x28, 0xF0, 0x20, 0x00 }, // '$'
+	{ 0xC8, 0xD0, 0x20, 0x20, 0x40, 0xB8, 0x18, 0x00 }, // '%'
+	{ 0x60, 0x90, 0x60, 0x40, 0xA8, 0x90, 0x68, 0x00 }, // '&'
+	{ 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // "'"
+	{ 0x10, 0x20, 0x40, 0x40, 0x40, 0x20, 0x10, 0x00 }, // '('
+	{ 0x40, 0x20, 0x10, 0x10, 0x10, 0x20, 0x40, 0x00 }, // ')'
+	{ 0x00, 0x20, 0xA8, 0x70, 0xA8, 0x20, 0x00, 0x00 }, // '*'
+	{ 0x00, 0x20, 0x20, 0xF8, 0x20, 0x20, 0x00, 0x00 }, // '+'
+	{ 0x00, 0x00, 0x00, 0x00, 0x30, 0x20, 0x40, 0x00 }, // ','
+	{ 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00 }, // '-'
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x00 }, // '.'
+	{ 0x08, 0x10, 0x10, 0x20, 0x40, 0x40, 0x80, 0x00 }, // '/'
+	{ 0x70, 0x88, 0x98, 0xA8, 0xC8, 0x88, 0x70, 0x00 }, // '0'
+	{ 0x20, 0x60, 0x20, 0x20, 0x20, 0x20, 0x70, 0x00 }, // '1'
+	{ 0x70, 0x88, 0x08, 0x10, 0x20, 0x40, 0xF8, 0x00 }, // '2'
+	{ 0xF8, 0x10, 0x20, 0x10, 0x08, 0x88, 0x70, 0x00 }, // '3'
+	{ 0x10, 0x30, 0x50, 0x90, 0xF8, 0x10, 0x10, 0x00 }, // '4'
+	{ 0xF8, 0x80, 0xF0, 0x08, 0x08, 0x88, 0x70, 0x00 }, // '5'
+	{ 0x30, 0x40, 0x80, 0xF0, 0x88, 0x88, 0x70, 0x00 }, // '6'
+	{ 0xF8, 0x08, 0x10, 0x20, 0x40, 0x40, 0x40, 0x00 }, // '7'
+	{ 0x70, 0x88, 0x88, 0x70, 0x88, 0x88, 0x70, 0x00 }, // '8'
+	{ 0x70, 0x88, 0x88, 0x78, 0x08, 0x10, 0x60, 0x00 }, // '9'
+	{ 0x00, 0x60, 0x60, 0x00, 0x60, 0x60, 0x00, 0x00 }, // ':'
+	{ 0x00, 0x60, 0x60, 0x00, 0x60, 0x20, 0x40, 0x00 }, // ';'
+	{ 0x10, 0x20, 0x40, 0x80, 0x40, 0x20, 0x10, 0x00 }, // '<'
+	{ 0x00, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0x00 }, // '='
+	{ 0x40, 0x20, 0x10, 0x08, 0x10, 0x20, 0x40, 0x00 }, // '>'
+	{ 0x70, 0x88, 0x08, 0x10, 0x20, 0x00, 0x20, 0x00 }, // '?'
+	{ 0x70, 0x88, 0x08, 0x68, 0xA8, 0xA8, 0x70, 0x00 }, // '@'
+	{ 0x70, 0x88, 0x88, 0xF8, 0x88, 0x88, 0x88, 0x00 }, // 'A'
+	{ 0xF0, 0x88, 0x88, 0xF0, 0x88, 0x88, 0xF0, 0x00 }, // 'B'
+	{ 0x70, 0x88, 0x80, 0x80, 0x80, 0x88, 0x70, 0x00 }, // 'C'
+	{ 0xE0, 0x90, 0x88, 0x88, 0x88, 0x90, 0xE0, 0x00 }, // 'D'
+	{ 0xF8, 0x80, 0x80, 0xF0, 0x80, 0x80, 0xF8, 0x00 }, // 'E'
+	{ 0xF8, 0x80, 0x80, 0xF0, 0x80, 0x80, 0x80, 0x00 }, // 'F'
+	{ 0x70, 0x88, 0x80, 0xB8, 0x88, 0x88, 0x78, 0x00 }, // 'G'
+	{ 0x88, 0x88, 0x88, 0xF8, 0x88, 0x88, 0x88, 0x00 }, // 'H'
+	{ 0x70, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x00 }, // 'I'
+	{ 0x38, 0x10, 0x10, 0x10, 0x10, 0x90, 0x60, 0x00 }, // 'J'
+	{ 0x88, 0x90, 0xA0, 0xC0, 0xA0, 0x90, 0x88, 0x00 }, // 'K'
+	{ 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF8, 0x00 }, // 'L'
+	{ 0x88, 0xD8, 0xA8, 0xA8, 0x88, 0x88, 0x88, 0x00 }, // 'M'
+	{ 0x88, 0x88, 0xC8, 0xA8, 0x98, 0x88, 0x88, 0x00 }, // 'N'
+	{ 0x70, 0x88, 0x88, 0x88, 0x88, 0x88, 0x70, 0x00 }, // 'O'
+	{ 0xF0, 0x88, 0x88, 0xF0, 0x80, 0x80, 0x80, 0x00 }, // 'P'
+	{ 0x70, 0x88, 0x88, 0x88, 0xA8, 0x90, 0x68, 0x00 }, // 'Q'
+	{ 0xF0, 0x88, 0x88, 0xF0, 0xA0, 0x90, 0x88, 0x00 }, // 'R'
+	{ 0x78, 0x80, 0x80, 0x70, 0x08, 0x08, 0xF0, 0x00 }, // 'S'
+	{ 0xF8, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00 }, // 'T'
+	{ 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x70, 0x00 }, // 'U'
+	{ 0x88, 0x88, 0x88, 0x88, 0x88, 0x50, 0x20, 0x00 }, // 'V'
+	{ 0x88, 0x88, 0x88, 0xA8, 0xA8, 0xA8, 0x50, 0x00 }, // 'W'
+	{ 0x88, 0x88, 0x50, 0x20, 0x50, 0x88, 0x88, 0x00 }, // 'X'
+	{ 0x88, 0x88, 0x88, 0x50, 0x20, 0x20, 0x20, 0x00 }, // 'Y'
+	{ 0xF8, 0x08, 0x10, 0x20, 0x40, 0x80, 0xF8, 0x00 }, // 'Z'
+	{ 0x70, 0x40, 0x40, 0x40, 0x40, 0x40, 0x70, 0x00 }, // '['
+	{ 0x80, 0x40, 0x40, 0x20, 0x10, 0x10, 0x08, 0x00 }, // '\\'
+	{ 0x70, 0x10, 0x10, 0x10, 0x10, 0x10, 0x70, 0x00 }, // ']'
+	{ 0x20, 0x50, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00 }, // '^'
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00 }, // '_'
+	{ 0x40, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // '`'
+	{ 0x00, 0x00, 0x70, 0x08, 0x78, 0x88, 0x78, 0x00 }, // 'a'
+	{ 0x80, 0x80, 0xB0, 0xC8, 0x88, 0x88, 0xF0, 0x00 }, // 'b'
+	{ 0x00, 0x00, 0x70, 0x80, 0x80, 0x88, 0x70, 0x00 }, // 'c'
+	{ 0x08, 0x08, 0x68, 0x98, 0x88, 0x88, 0x78, 0x00 }, // 'd'
+	{ 0x00, 0x00, 0x70, 0x88, 0xF8, 0x80, 0x70, 0x00 }, // 'e'
+	{ 0x30, 0x48, 0x40, 0xE0, 0x40, 0x40, 0x40, 0x00 }, // 'f'
+	{ 0x00, 0x78, 0x88, 0x88, 0x78, 0x08, 0x70, 0x00 }, // 'g'
+	{ 0x80, 0x80, 0xB0, 0xC8, 0x88, 0x88, 0x88, 0x00 }, // 'h'
+	{ 0x20, 0x00, 0x60, 0x20, 0x20, 0x20, 0x70, 0x00 }, // 'i'
+	{ 0x10, 0x00, 0x30, 0x10, 0x10, 0x90, 0x60, 0x00 }, // 'j'
+	{ 0x80, 0x80, 0x90, 0xA0, 0xC0, 0xA0, 0x90, 0x00 }, // 'k'
+	{ 0x60, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x00 }, // 'l'
+	{ 0x00, 0x00, 0xD0, 0xA8, 0xA8, 0x88, 0x88, 0x00 }, // 'm'
+	{ 0x00, 0x00, 0xB0, 0xC8, 0x88, 0x88, 0x88, 0x00 }, // 'n'
+	{ 0x00, 0x00, 0x70, 0x88, 0x88, 0x88, 0x70, 0x00 }, // 'o'
+	{ 0x00, 0x00, 0xF0, 0x88, 0xF0, 0x80, 0x80, 0x00 }, // 'p'
+	{ 0x00, 0x00, 0x68, 0x98, 0x78, 0x08, 0x08, 0x00 }, // 'q'
+	{ 0x00, 0x00, 0xB0, 0xC8, 0x80, 0x80, 0x80, 0x00 }, // 'r'
+	{ 0x00, 0x00, 0x70, 0x80, 0x70, 0x08, 0xF0, 0x00 }, // 's'
+	{ 0x40, 0x40, 0xE0, 0x40, 0x40, 0x48, 0x30, 0x00 }, // 't'
+	{ 0x00, 0x00, 0x88, 0x88, 0x88, 0x98, 0x68, 0x00 }, // 'u'
+	{ 0x00, 0x00, 0x88, 0x88, 0x88, 0x50, 0x20, 0x00 }, // 'v'
+	{ 0x00, 0x00, 0x88, 0x88, 0xA8, 0xA8, 0x50, 0x00 }, // 'w'
+	{ 0x00, 0x00, 0x88, 0x50, 0x20, 0x50, 0x88, 0x00 }, // 'x'
+	{ 0x00, 0x00, 0x88, 0x88, 0x78, 0x08, 0x70, 0x00 }, // 'y'
+	{ 0x00, 0x00, 0xF8, 0x10, 0x20, 0x40, 0xF8, 0x00 }, // 'z'
+	{ 0x10, 0x20, 0x20, 0x40, 0x20, 0x20, 0x10, 0x00 }, // '{'
+	{ 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00 }, // '|'
+	{ 0x40, 0x20, 0x20, 0x10, 0x20, 0x20, 0x40, 0x00 }, // '}'
+	{ 0x00, 0x00, 0x40, 0xA8, 0x10, 0x00, 0x00, 0x00 }, // '~'
+};
+
+void host_gfx_site(const char *file, int line, const char *func)
+{
+	for (size_t i = 0; i < n_sites; ++i) {
+		if (sites[i].line == line && !strcmp(sites[i].file, file)) {
+			cur_site = &sites[i];
+			++cur_site->calls;
+			return;
+		}
+	}
+
+	if (n_sites == MAX_SITES) {
+		cur_site = NULL;
+		return;
+	}
+	cur_site = &sites[n_sites++];
+	cur_site->file = file;
+	cur_site->line = line;
+	cur_site->func = func;
+	cur_site->calls = 1;
+}
+
+static uint8_t (*target(void))[W]
+{
+	return vram[(draw_target == gfx_screen) ? screen : !screen];
+}
+
+/* All drawing goes through here. Pixels outside the screen are dropped,
+ * which stands in for graphx's clipping.
+ */
+static void put(int x, int y, uint8_t c)
+{
+	if (x < 0 || y < 0 || x >= W || y >= H)
+		return;
+	if (clipped && (x < clip_xmin || y < clip_ymin ||
+		x >= clip_xmax || y >= clip_ymax))
+		return;
+
+	bool changed = c != vram[screen][y][x];
+	target()[y][x] = c;
+
+	++cur_frame.writes;
+	touched[y][x] = 1;
+	if (cur_site) {
+		++cur_site->writes;
+		cur_site->changed += changed;
+	}
+}
+
+int gfx_Begin(void)
+{
+	memset(vram, 0, sizeof vram);
+	screen = 0;
+	draw_target = gfx_screen;
+	return 0;
+}
+
+void gfx_End(void)
+{
+}
+
+void gfx_SetDraw(uint8_t location)
+{
+	draw_target = location;
+}
+
+#define PPM_HEADER "P6\n320 240\n255\n"
+#define PPM_SIZE (sizeof PPM_HEADER - 1 + W * H * 3)
+
+/* Renders pixels through the palette into a binary PPM image. */
+static void to_ppm(uint8_t *ppm, const uint8_t pixels[H][W])
+{
+	memcpy(ppm, PPM_HEADER, sizeof PPM_HEADER - 1);
+	ppm += sizeof PPM_HEADER - 1;
+
+	for (int y = 0; y < H; ++y) {
+		for (int x = 0; x < W; ++x) {
+			// 1555 with red in the high bits, as gfx_SetPalette takes
+			uint16_t c = host_gfx_palette[pixels[y][x]];
+			*ppm++ = (c >> 10 & 0x1F) * 255 / 31;
+			*ppm++ = (c >> 5 & 0x1F) * 255 / 31;
+			*ppm++ = (c & 0x1F) * 255 / 31;
+		}
+	}
+}
+
+static void write_ppm(const char *path, const uint8_t *ppm)
+{
+	FILE *f = fopen(path, "wb");
+	if (!f || fwrite(ppm, 1, PPM_SIZE, f) != PPM_SIZE) {
+		perror(path);
+		exit(EXIT_FAILURE);
+	}
+	fclose(f);
+}
+
+static bool same_as_file(const char *path, const uint8_t *ppm)
+{
+	static uint8_t golden[PPM_SIZE + 1];
+
+	FILE *f = fopen(path, "rb");
+	if (!f)
+		return false;
+	size_t n = fread(golden, 1, sizeof golden, f);
+	fclose(f);
+	return n == PPM_SIZE && !memcmp(golden, ppm, PPM_SIZE);
+}
+
+/* Writes out the frame on screen or compares it against the stored one, and
+ * records the current frame's totals.
+ */
+static void show(const uint8_t pixels[H][W])
+{
+	static uint8_t ppm[PPM_SIZE];
+	char path[512];
+	if (ppm_dir || golden_dir)
+		to_ppm(ppm, pixels);
+	if (ppm_dir) {
+		snprintf(path, sizeof path, "%s/frame%04zu.ppm", ppm_dir, n_frames);
+		write_ppm(path, ppm);
+	}
+	if (golden_dir) {
+		snprintf(path, sizeof path, "%s/frame%04zu.ppm", golden_dir,
+			n_frames);
+		if (!same_as_file(path, ppm)) {
+			fprintf(stderr, "frame %zu differs from %s\n", n_frames, path);
+			++golden_mismatches;
+		}
+	}
+
+	if (n_frames < MAX_FRAMES)
+		frames[n_frames] = cur_frame;
+	++n_frames;
+	memset(&cur_frame, 0, sizeof cur_frame);
+	memset(touched, 0, sizeof touched);
+}
+
+/* Ends a frame: the buffer becomes the screen and the frame's totals are
+ * recorded.
+ */
+void gfx_SwapDraw(void)
+{
+	screen = !screen;
+
+	cur_frame.touched = 0;
+	cur_frame.changed = 0;
+	for (int y = 0; y < H; ++y) {
+		for (int x = 0; x < W; ++x) {
+			cur_frame.touched += touched[y][x];
+			cur_frame.changed += vram[screen][y][x] != vram[!screen][y][x];
+		}
+	}
+	show(vram[screen]);
+}
+
+/* A frame that was drawn without graphx, which isn't accounted per pixel. */
+void host_gfx_show(const uint8_t pixels[H][W])
+{
+	show(pixels);
+}
+
+void gfx_Blit(gfx_location_t src)
+{
+	int from = (src == gfx_screen) ? screen : !screen;
+	int old_target = draw_target;
+
+	// Copied through put() so that the copy is accounted for.
+	draw_target = (from == screen) ? gfx_buffer : gfx_screen;
+	clipped = false;
+	for (int y = 0; y < H; ++y)
+		for (int x = 0; x < W; ++x)
+			put(x, y, vram[from][y][x]);
+	clipped = true;
+	draw_target = old_target;
+}
+
+void gfx_SetClipRegion(int xmin, int ymin, int xmax, int ymax)
+{
+	clip_xmin = xmin;
+	clip_ymin = ymin;
+	clip_xmax = xmax;
+	clip_ymax = ymax;
+}
+
+void gfx_SetTextConfig(uint8_t config)
+{
+	text_clip = config == gfx_text_clip;
+}
+
+void gfx_SetPalette(const void *data, uint24_t size, uint8_t offset)
+{
+	const uint8_t *p = data;
+	for (uint24_t i = 0; i < size / 2 && offset + i < 256; ++i)
+		host_gfx_palette[offset + i] = p[2 * i] | p[2 * i + 1] << 8;
+}
+
+uint8_t gfx_SetColor(uint8_t index)
+{
+	uint8_t old = color;
+	color = index;
+	return old;
+}
+
+uint8_t gfx_SetTransparentColor(uint8_t index)
+{
+	uint8_t old = transparent;
+	transparent = index;
+	return old;
+}
+
+uint8_t gfx_SetTextFGColor(uint8_t c)
+{
+	uint8_t old = text_fg;
+	text_fg = c;
+	return old;
+}
+
+uint8_t gfx_SetTextBGColor(uint8_t c)
+{
+	uint8_t old = text_bg;
+	text_bg = c;
+	return old;
+}
+
+uint8_t gfx_SetTextTransparentColor(uint8_t c)
+{
+	uint8_t old = text_transparent;
+	text_transparent = c;
+	return old;
+}
+
+void gfx_FillScreen(uint8_t index)
+{
+	clipped = false;
+	for (int y = 0; y < H; ++y)
+		for (int x = 0; x < W; ++x)
+			put(x, y, index);
+	clipped = true;
+}
+
+void gfx_FillRectangle(int x, int y, int width, int height)
+{
+	for (int j = 0; j < height; ++j)
+		for (int i = 0; i < width; ++i)
+			put(x + i, y + j, color);
+}
+
+void gfx_HorizLine(int x, int y, int length)
+{
+	for (int i = 0; i < length; ++i)
+		put(x + i, y, color);
+}
+
+void gfx_VertLine(int x, int y, int length)
+{
+	for (int j = 0; j < length; ++j)
+		put(x, y + j, color);
+}
+
+void gfx_Rectangle(int x, int y, int width, int height)
+{
+	gfx_HorizLine(x, y, width);
+	gfx_HorizLine(x, y + height - 1, width);
+	gfx_VertLine(x, y + 1, height - 2);
+	gfx_VertLine(x + width - 1, y + 1, height - 2);
+}
+
+/* Moves the pixels in the clip region of the buffer being drawn by dx, dy.
+ * Those moved in from outside the region keep what they had, as with graphx.
+ */
+static void shift(int dx, int dy)
+{
+	static uint8_t copy[H][W];
+
+	memcpy(copy, target(), sizeof copy);
+	for (int y = clip_ymin; y < clip_ymax; ++y) {
+		for (int x = clip_xmin; x < clip_xmax; ++x) {
+			int sx = x - dx, sy = y - dy;
+			if (sx >= clip_xmin && sx < clip_xmax
+				&& sy >= clip_ymin && sy < clip_ymax)
+				put(x, y, copy[sy][sx]);
+		}
+	}
+}
+
+void gfx_ShiftDown(uint8_t pixels)
+{
+	shift(0, pixels);
+}
+
+void gfx_ShiftUp(uint8_t pixels)
+{
+	shift(0, -pixels);
+}
+
+void gfx_ShiftLeft(uint24_t pixels)
+{
+	shift(-(int) pixels, 0);
+}
+
+void gfx_ShiftRight(uint24_t pixels)
+{
+	shift(pixels, 0);
+}
+
+void gfx_Sprite(const gfx_sprite_t *sprite, int x, int y)
+{
+	const uint8_t *p = sprite->data;
+	for (int j = 0; j < sprite->height; ++j)
+		for (int i = 0; i < sprite->width; ++i)
+			put(x + i, y + j, *p++);
+}
+
+void gfx_TransparentSprite(const gfx_sprite_t *sprite, int x, int y)
+{
+	const uint8_t *p = sprite->data;
+	for (int j = 0; j < sprite->height; ++j) {
+		for (int i = 0; i < sprite->width; ++i, ++p) {
+			if (*p != transparent)
+				put(x + i, y + j, *p);
+		}
+	}
+}
+
+void gfx_TransparentSprite_NoClip(const gfx_sprite_t *sprite, uint24_t x,
+	uint8_t y)
+{
+	clipped = false;
+	gfx_TransparentSprite(sprite, x, y);
+	clipped = true;
+}
+
+void gfx_ScaledSprite_NoClip(const gfx_sprite_t *sprite, uint24_t x,
+	uint8_t y, uint8_t width_scale, uint8_t height_scale)
+{
+	int w = sprite->width * width_scale, h = sprite->height * height_scale;
+	clipped = false;
+	for (int j = 0; j < h; ++j) {
+		for (int i = 0; i < w; ++i) {
+			put(x + i, y + j, sprite->data[j / height_scale
+				* sprite->width + i / width_scale]);
+		}
+	}
+	clipped = true;
+}
+
+void gfx_ScaledTransparentSprite_NoClip(const gfx_sprite_t *sprite,
+	uint24_t x, uint8_t y, uint8_t width_scale, uint8_t height_scale)
+{
+	int w = sprite->width * width_scale, h = sprite->height * height_scale;
+	clipped = false;
+	for (int j = 0; j < h; ++j) {
+		for (int i = 0; i < w; ++i) {
+			uint8_t c = sprite->data[j / height_scale
+				* sprite->width + i / width_scale];
+			if (c != transparent)
+				put(x + i, y + j, c);
+		}
+	}
+	clipped = true;
+}
+
+gfx_sprite_t *gfx_FlipSpriteY(const gfx_sprite_t *sprite_in,
+	gfx_sprite_t *sprite_out)
+{
+	uint8_t w = sprite_in->width, h = sprite_in->height;
+
+	sprite_out->width = w;
+	sprite_out->height = h;
+	for (int y = 0; y < h; ++y)
+		for (int x = 0; x < w; ++x)
+			sprite_out->data[y * w + x] =
+				sprite_in->data[y * w + w - 1 - x];
+	return sprite_out;
+}
+
+/* Like gfx_PrintChar(), but into a sprite that is reused by every call. */
+gfx_sprite_t *gfx_GetSpriteChar(char c)
+{
+	static uint8_t buf[2 + CHAR_WIDTH * 8];
+	gfx_sprite_t *sprite = (gfx_sprite_t *) buf;
+	const uint8_t *glyph = (c >= ' ' && c <= '~') ? font[c - ' '] : font[0];
+
+	sprite->width = CHAR_WIDTH;
+	sprite->height = 8;
+	for (int j = 0; j < 8; ++j) {
+		for (int i = 0; i < CHAR_WIDTH; ++i) {
+			sprite->data[j * CHAR_WIDTH + i] =
+				(i > 0 && (glyph[j] & (0x80 >> (i - 1)))) ?
+				text_fg : text_bg;
+		}
+	}
+	return sprite;
+}
+
+void gfx_SetTextXY(int x, int y)
+{
+	text_x = x;
+	text_y = y;
+}
+
+void gfx_PrintChar(const char c)
+{
+	const uint8_t *glyph = (c >= ' ' && c <= '~') ? font[c - ' '] : font[0];
+
+	clipped = text_clip;
+
+	for (int j = 0; j < 8; ++j) {
+		for (int i = 0; i < CHAR_WIDTH; ++i) {
+			// The glyphs are five columns wide and drawn one in.
+			if (i > 0 && (glyph[j] & (0x80 >> (i - 1))))
+				put(text_x + i, text_y + j, text_fg);
+			else if (text_bg != text_transparent)
+				put(text_x + i, text_y + j, text_bg);
+		}
+	}
+	text_x += CHAR_WIDTH;
+	clipped = true;
+}
+
+void gfx_PrintString(const char *string)
+{
+	while (*string)
+		gfx_PrintChar(*string++);
+}
+
+void gfx_PrintStringXY(const char *string, int x, int y)
+{
+	gfx_SetTextXY(x, y);
+	gfx_PrintString(string);
+}
+
+/* graphx's default font is 8 pixels wide for nearly every character. */
+unsigned int gfx_GetCharWidth(const char c)
+{
+	(void) c;
+	return CHAR_WIDTH;
+}
+
+unsigned int gfx_GetStringWidth(const char *string)
+{
+	return CHAR_WIDTH * strlen(string);
+}
+
+void host_gfx_set_ppm_dir(const char *dir)
+{
+	ppm_dir = dir;
+}
+
+void host_gfx_set_golden_dir(const char *dir)
+{
+	golden_dir = dir;
+}
+
+unsigned long host_gfx_golden_mismatches(void)
+{
+	return golden_mismatches;
+}
+
+/* Per frame: pixels written, distinct pixels written and pixels that differ
+ * from the previous frame. Everything written beyond the changed pixels was
+ * wasted work.
+ */
+void host_gfx_print_frames(FILE *f)
+{
+	fprintf(f, "%6s %10s %10s %10s %9s\n",
+		"frame", "written", "distinct", "changed", "wasted");
+	for (size_t i = 0; i < n_frames && i < MAX_FRAMES; ++i) {
+		struct frame *fr = &frames[i];
+		fprintf(f, "%6zu %10lu %10lu %10lu %8.1f%%\n", i, fr->writes,
+			fr->touched, fr->changed, fr->writes ? 100.0
+			* (fr->writes - fr->changed) / fr->writes : 0.0);
+	}
+}
+
+static int by_writes(const void *a, const void *b)
+{
+	const struct site *x = a, *y = b;
+	return (x->writes < y->writes) - (x->writes > y->writes);
+}
+
+/* Totals per call site, most pixels first. "changed" counts the writes that
+ * stored a different value than the screen showed at the time.
+ */
+void host_gfx_print_sites(FILE *f, size_t max_sites)
+{
+	unsigned long writes = 0, changed = 0;
+
+	qsort(sites, n_sites, sizeof sites[0], by_writes);
+	cur_site = NULL;
+
+	fprintf(f, "%-40s %8s %12s %12s %9s\n",
+		"call site", "calls", "written", "changed", "wasted");
+	for (size_t i = 0; i < n_sites; ++i) {
+		struct site *s = &sites[i];
+		writes += s->writes;
+		changed += s->changed;
+		if (i >= max_sites)
+			continue;
+
+		const char *file = strrchr(s->file, '/');
+		char where[128];
+		snprintf(where, sizeof where, "%s:%d %s()",
+			file ? file + 1 : s->file, s->line, s->func);
+		fprintf(f, "%-40s %8lu %12lu %12lu %8.1f%%\n", where, s->calls,
+			s->writes, s->changed, s->writes ? 100.0
+			* (s->writes - s->changed) / s->writes : 0.0);
+	}
+	fprintf(f, "%zu frames, %lu pixels written, %lu changed (%.1f%% wasted)\n",
+		n_frames, writes, changed,
+		writes ? 100.0 * (writes - changed) / writes : 0.0);
+}
@@ -0,0 +1,22 @@
+/* Functions of the host stand-ins that only the host programs use. */
+
+#ifndef BENCH_HOST_HOST_H
+#define BENCH_HOST_HOST_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <ti/getcsc.h>
+
+/* Scripted input for os_GetCSC() and kb_Scan(); 0 means no key. */
+void host_set_keys(const sk_key_t *keys, size_t n);
+
+/* Frame accounting of the graphx stand-in. */
+void host_gfx_set_ppm_dir(const char *dir);
+void host_gfx_set_golden_dir(const char *dir);
+void host_gfx_print_frames(FILE *f);
+void host_gfx_print_sites(FILE *f, size_t max_sites);
+unsigned long host_gfx_golden_mismatches(void);
+void host_gfx_show(const uint8_t pixels[240][320]);
+
+#endif // BENCH_HOST_HOST_H
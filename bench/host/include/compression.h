@@ -0,0 +1,9 @@
+/* Host stand-in for the CE toolchain's <compression.h>. */
+
+#ifndef HOST_COMPRESSION_H
+#define HOST_COMPRESSION_H
+
+void zx7_Decompress(void *dst, const void *src);
+void zx0_Decompress(void *dst, const void *src);
+
+#endif // HOST_COMPRESSION_H
@@ -0,0 +1,16 @@
+/* Host stand-in for the CE toolchain's <debug.h>. The debug console is
+ * standard error.
+ */
+
+#ifndef HOST_DEBUG_H
+#define HOST_DEBUG_H
+
+#include <stdio.h>
+
+#ifdef DEBUG
+#define dbg_printf(...) fprintf(stderr, __VA_ARGS__)
+#else
+#define dbg_printf(...) ((void) 0)
+#endif
+
+#endif // HOST_DEBUG_H
@@ -0,0 +1,120 @@
+/* Host stand-in for the parts of the CE toolchain's graphx library used by
+ * the games. Drawing goes to two 320x240 8bpp buffers like on the calculator
+ * and every pixel written is accounted to the call site that wrote it (see
+ * graphx.c).
+ */
+
+#ifndef HOST_GRAPHX_H
+#define HOST_GRAPHX_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#define GFX_LCD_WIDTH 320
+#define GFX_LCD_HEIGHT 240
+
+typedef struct gfx_sprite_t {
+	uint8_t width;
+	uint8_t height;
+	uint8_t data[];
+} gfx_sprite_t;
+
+typedef enum {
+	gfx_screen = 0,
+	gfx_buffer,
+} gfx_location_t;
+
+int gfx_Begin(void);
+void gfx_End(void);
+void gfx_SetDraw(uint8_t location);
+#define gfx_SetDrawBuffer() gfx_SetDraw(gfx_buffer)
+#define gfx_SetDrawScreen() gfx_SetDraw(gfx_screen)
+void gfx_SwapDraw(void);
+void gfx_Blit(gfx_location_t src);
+#define gfx_BlitBuffer() gfx_Blit(gfx_buffer)
+#define gfx_BlitScreen() gfx_Blit(gfx_screen)
+
+void gfx_SetClipRegion(int xmin, int ymin, int xmax, int ymax);
+
+typedef enum {
+	gfx_text_clip = 1,
+	gfx_text_noclip,
+} gfx_text_options_t;
+
+void gfx_SetTextConfig(uint8_t config);
+
+void gfx_SetPalette(const void *palette, uint24_t size, uint8_t offset);
+
+// The LCD palette, which is memory mapped on the calculator.
+extern uint16_t host_gfx_palette[256];
+#define gfx_palette host_gfx_palette
+uint8_t gfx_SetColor(uint8_t index);
+uint8_t gfx_SetTransparentColor(uint8_t index);
+uint8_t gfx_SetTextFGColor(uint8_t color);
+uint8_t gfx_SetTextBGColor(uint8_t color);
+uint8_t gfx_SetTextTransparentColor(uint8_t color);
+
+void gfx_FillScreen(uint8_t index);
+void gfx_FillRectangle(int x, int y, int width, int height);
+void gfx_HorizLine(int x, int y, int length);
+void gfx_VertLine(int x, int y, int length);
+void gfx_Rectangle(int x, int y, int width, int height);
+
+void gfx_ShiftDown(uint8_t pixels);
+void gfx_ShiftUp(uint8_t pixels);
+void gfx_ShiftLeft(uint24_t pixels);
+void gfx_ShiftRight(uint24_t pixels);
+
+void gfx_Sprite(const gfx_sprite_t *sprite, int x, int y);
+void gfx_TransparentSprite(const gfx_sprite_t *sprite, int x, int y);
+void gfx_TransparentSprite_NoClip(const gfx_sprite_t *sprite, uint24_t x,
+	uint8_t y);
+void gfx_ScaledSprite_NoClip(const gfx_sprite_t *sprite, uint24_t x,
+	uint8_t y, uint8_t width_scale, uint8_t height_scale);
+void gfx_ScaledTransparentSprite_NoClip(const gfx_sprite_t *sprite,
+	uint24_t x, uint8_t y, uint8_t width_scale, uint8_t height_scale);
+gfx_sprite_t *gfx_FlipSpriteY(const gfx_sprite_t *sprite_in,
+	gfx_sprite_t *sprite_out);
+
+void gfx_SetTextXY(int x, int y);
+void gfx_PrintChar(const char c);
+void gfx_PrintString(const char *string);
+void gfx_PrintStringXY(const char *string, int x, int y);
+unsigned int gfx_GetStringWidth(const char *string);
+unsigned int gfx_GetCharWidth(const char c);
+gfx_sprite_t *gfx_GetSpriteChar(char c);
+
+/* The drawing calls record where they were called from, so that the pixels
+ * they write can be attributed to a line of the game sources.
+ */
+void host_gfx_site(const char *file, int line, const char *func);
+
+#ifndef HOST_GRAPHX_IMPL
+#define HOST_GFX_SITE(call) \
+	(host_gfx_site(__FILE__, __LINE__, __func__), call)
+#define gfx_FillScreen(...) HOST_GFX_SITE(gfx_FillScreen(__VA_ARGS__))
+#define gfx_FillRectangle(...) HOST_GFX_SITE(gfx_FillRectangle(__VA_ARGS__))
+#define gfx_HorizLine(...) HOST_GFX_SITE(gfx_HorizLine(__VA_ARGS__))
+#define gfx_VertLine(...) HOST_GFX_SITE(gfx_VertLine(__VA_ARGS__))
+#define gfx_Rectangle(...) HOST_GFX_SITE(gfx_Rectangle(__VA_ARGS__))
+#define gfx_ShiftDown(...) HOST_GFX_SITE(gfx_ShiftDown(__VA_ARGS__))
+#define gfx_ShiftUp(...) HOST_GFX_SITE(gfx_ShiftUp(__VA_ARGS__))
+#define gfx_ShiftLeft(...) HOST_GFX_SITE(gfx_ShiftLeft(__VA_ARGS__))
+#define gfx_ShiftRight(...) HOST_GFX_SITE(gfx_ShiftRight(__VA_ARGS__))
+#define gfx_Sprite(...) HOST_GFX_SITE(gfx_Sprite(__VA_ARGS__))
+#define gfx_TransparentSprite(...) \
+	HOST_GFX_SITE(gfx_TransparentSprite(__VA_ARGS__))
+#define gfx_TransparentSprite_NoClip(...) \
+	HOST_GFX_SITE(gfx_TransparentSprite_NoClip(__VA_ARGS__))
+#define gfx_ScaledSprite_NoClip(...) \
+	HOST_GFX_SITE(gfx_ScaledSprite_NoClip(__VA_ARGS__))
+#define gfx_ScaledTransparentSprite_NoClip(...) \
+	HOST_GFX_SITE(gfx_ScaledTransparentSprite_NoClip(__VA_ARGS__))
+#define gfx_PrintChar(...) HOST_GFX_SITE(gfx_PrintChar(__VA_ARGS__))
+#define gfx_PrintString(...) HOST_GFX_SITE(gfx_PrintString(__VA_ARGS__))
+#define gfx_PrintStringXY(...) HOST_GFX_SITE(gfx_PrintStringXY(__VA_ARGS__))
+#define gfx_Blit(...) HOST_GFX_SITE(gfx_Blit(__VA_ARGS__))
+#endif // HOST_GRAPHX_IMPL
+
+#endif // HOST_GRAPHX_H
@@ -0,0 +1,14 @@
+/* Host stand-in for the CE toolchain's keypadc library. The key data is
+ * supplied by the program driving the games instead of the keypad.
+ */
+
+#ifndef HOST_KEYPADC_H
+#define HOST_KEYPADC_H
+
+#include <stdint.h>
+
+extern uint16_t kb_Data[8];
+
+void kb_Scan(void);
+
+#endif // HOST_KEYPADC_H
@@ -0,0 +1,17 @@
+/* The CE toolchain's <stdint.h> has 24-bit integer types, which the host's
+ * does not. The widest type that behaves the same for the values the games
+ * store is used instead.
+ */
+
+#ifndef HOST_STDINT_H
+#define HOST_STDINT_H
+
+#include_next <stdint.h>
+
+typedef int32_t int24_t;
+typedef uint32_t uint24_t;
+
+#define INT24_MAX 8388607
+#define UINT24_MAX 16777215
+
+#endif // HOST_STDINT_H
@@ -0,0 +1,27 @@
+/* Host stand-in for the CE toolchain's <sys/lcd.h>. VRAM is an array and
+ * the registers are variables. Reading the interrupt status after a new
+ * base address was acknowledged shows the frame at that address, so frames
+ * drawn straight to VRAM are seen by replay too (see sdk.c).
+ */
+
+#ifndef HOST_SYS_LCD_H
+#define HOST_SYS_LCD_H
+
+#include <stdint.h>
+
+#define LCD_WIDTH 320
+#define LCD_HEIGHT 240
+
+extern uint8_t host_lcd_ram[LCD_WIDTH * LCD_HEIGHT * 2];
+extern uint24_t host_lcd_control;
+extern uintptr_t host_lcd_upbase;
+extern uint8_t host_lcd_int_acknowledge;
+uint8_t host_lcd_int_status(void);
+
+#define lcd_Ram ((uint16_t *) host_lcd_ram)
+#define lcd_Control host_lcd_control
+#define lcd_UpBase host_lcd_upbase
+#define lcd_IntAcknowledge host_lcd_int_acknowledge
+#define lcd_IntStatus host_lcd_int_status()
+
+#endif // HOST_SYS_LCD_H
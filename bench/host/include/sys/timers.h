@@ -0,0 +1,13 @@
+/* Host stand-in for the CE toolchain's <sys/timers.h>. Sleeping returns
+ * immediately so that headless runs are not slowed down.
+ */
+
+#ifndef HOST_SYS_TIMERS_H
+#define HOST_SYS_TIMERS_H
+
+#include <stdint.h>
+
+void host_usleep(unsigned long usec);
+#define usleep(usec) host_usleep(usec)
+
+#endif // HOST_SYS_TIMERS_H
@@ -0,0 +1,11 @@
+/* Host stand-in for the CE toolchain's <sys/util.h>. */
+
+#ifndef HOST_SYS_UTIL_H
+#define HOST_SYS_UTIL_H
+
+#include <stdlib.h>
+
+#define randInt(min, max) \
+	((unsigned) random() % ((max) - (min) + 1) + (min))
+
+#endif // HOST_SYS_UTIL_H
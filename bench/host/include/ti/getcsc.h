@@ -0,0 +1,35 @@
+/* Host stand-in for the CE toolchain's <ti/getcsc.h>. The scan codes are
+ * the calculator's.
+ */
+
+#ifndef HOST_TI_GETCSC_H
+#define HOST_TI_GETCSC_H
+
+#include <stdint.h>
+
+typedef uint8_t sk_key_t;
+
+#define sk_Down  0x01
+#define sk_Left  0x02
+#define sk_Right 0x03
+#define sk_Up    0x04
+#define sk_Enter 0x09
+#define sk_Clear 0x0F
+#define sk_9     0x14
+#define sk_6     0x13
+#define sk_3     0x12
+#define sk_8     0x1C
+#define sk_5     0x1B
+#define sk_2     0x1A
+#define sk_0     0x21
+#define sk_1     0x22
+#define sk_4     0x23
+#define sk_7     0x24
+#define sk_Zoom  0x33
+#define sk_2nd   0x36
+#define sk_Mode  0x37
+#define sk_Del   0x38
+
+sk_key_t os_GetCSC(void);
+
+#endif // HOST_TI_GETCSC_H
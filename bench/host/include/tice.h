@@ -0,0 +1,24 @@
+/* Host stand-in for the CE toolchain's <tice.h>. */
+
+#ifndef HOST_TICE_H
+#define HOST_TICE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+#include <sys/timers.h>
+#include <sys/util.h>
+#include <ti/getcsc.h>
+
+#define LCD_WIDTH 320
+#define LCD_HEIGHT 240
+
+// The OS scratch area, see sdk.c.
+extern uint8_t host_pixel_shadow[];
+#define os_PixelShadow ((uint8_t *) host_pixel_shadow)
+
+uint32_t rtc_Time(void);
+
+#endif // HOST_TICE_H
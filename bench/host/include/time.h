@@ -0,0 +1,17 @@
+/* Host stand-in for the CE toolchain's <time.h>. clock() ticks at the
+ * calculator's 32768 Hz, but only when usleep() is called, so that a replay
+ * sees the same times on every run.
+ */
+
+#ifndef HOST_TIME_H
+#define HOST_TIME_H
+
+#include_next <time.h>
+
+#undef CLOCKS_PER_SEC
+#define CLOCKS_PER_SEC ((clock_t) 32768)
+
+clock_t host_clock(void);
+#define clock() host_clock()
+
+#endif // HOST_TIME_H
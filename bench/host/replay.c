@@ -0,0 +1,142 @@
+/* Plays a scripted session of the whole program headlessly and reports how
+ * many pixels each frame and each drawing call site wrote, and how many of
+ * them changed anything on screen.
+ *
+ * The script is one of the autotester scenarios in bench/scenarios (only the
+ * "key|..." and "delay|..." steps are used) or a list of key names given
+ * with --keys. A delay becomes one idle poll per 100 ms, which is how often
+ * the snake polls the keypad. Once the script runs out, Clear is pressed
+ * until the program exits.
+ *
+ * --ppm DIR writes every frame as DIR/frameNNNN.ppm, and --check DIR
+ * compares every frame against such images instead, so that a directory of
+ * known good frames works as a golden-image test.
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "host.h"
+
+#define MAX_KEYS 8192
+#define DELAY_MS_PER_POLL 100
+
+int matharc_main(void);
+
+static const struct {
+	const char *name;
+	sk_key_t key;
+} key_names[] = {
+	{ "down", sk_Down }, { "left", sk_Left }, { "right", sk_Right },
+	{ "up", sk_Up }, { "enter", sk_Enter }, { "clear", sk_Clear },
+	{ "2nd", sk_2nd }, { "mode", sk_Mode }, { "del", sk_Del },
+	{ "zoom", sk_Zoom },
+	{ "0", sk_0 }, { "1", sk_1 }, { "2", sk_2 }, { "3", sk_3 },
+	{ "4", sk_4 }, { "5", sk_5 }, { "6", sk_6 }, { "7", sk_7 },
+	{ "8", sk_8 }, { "9", sk_9 }, { ".", 0 },
+};
+
+static sk_key_t keys[MAX_KEYS];
+static size_t n_keys;
+
+static void add_key(sk_key_t key)
+{
+	if (n_keys == MAX_KEYS) {
+		fprintf(stderr, "script too long\n");
+		exit(EXIT_FAILURE);
+	}
+	keys[n_keys++] = key;
+}
+
+static void add_key_name(const char *name, size_t len)
+{
+	for (size_t i = 0; i < sizeof key_names / sizeof key_names[0]; ++i) {
+		if (strlen(key_names[i].name) == len &&
+			!strncmp(key_names[i].name, name, len)) {
+			add_key(key_names[i].key);
+			return;
+		}
+	}
+	fprintf(stderr, "unknown key '%.*s'\n", (int) len, name);
+	exit(EXIT_FAILURE);
+}
+
+/* Space separated key names; "." is a poll without a key. */
+static void parse_keys(const char *s)
+{
+	while (*s) {
+		size_t len = strcspn(s, " ");
+		if (len)
+			add_key_name(s, len);
+		s += len + strspn(s + len, " ");
+	}
+}
+
+static void parse_scenario(const char *path)
+{
+	FILE *f = fopen(path, "r");
+	if (!f) {
+		perror(path);
+		exit(EXIT_FAILURE);
+	}
+
+	char line[256];
+	while (fgets(line, sizeof line, f)) {
+		char *step;
+		if ((step = strstr(line, "\"key|"))) {
+			step += strlen("\"key|");
+			add_key_name(step, strcspn(step, "\""));
+		} else if ((step = strstr(line, "\"delay|"))) {
+			long ms = strtol(step + strlen("\"delay|"), NULL, 10);
+			for (long i = 0; i < ms / DELAY_MS_PER_POLL; ++i)
+				add_key(0);
+		}
+	}
+	fclose(f);
+}
+
+int main(int argc, char *argv[])
+{
+	bool frames = false;
+	long max_sites = 15;
+
+	for (int i = 1; i < argc; ++i) {
+		if (!strcmp(argv[i], "--keys") && i + 1 < argc) {
+			parse_keys(argv[++i]);
+		} else if (!strcmp(argv[i], "--ppm") && i + 1 < argc) {
+			host_gfx_set_ppm_dir(argv[++i]);
+		} else if (!strcmp(argv[i], "--check") && i + 1 < argc) {
+			host_gfx_set_golden_dir(argv[++i]);
+		} else if (!strcmp(argv[i], "--sites") && i + 1 < argc) {
+			max_sites = strtol(argv[++i], NULL, 10);
+		} else if (!strcmp(argv[i], "--frames")) {
+			frames = true;
+		} else if (argv[i][0] != '-') {
+			parse_scenario(argv[i]);
+		} else {
+			fprintf(stderr, "usage: %s [SCENARIO.json] [--keys KEYS] "
+				"[--frames] [--sites N] [--ppm DIR] [--check DIR]\n",
+				argv[0]);
+			return EXIT_FAILURE;
+		}
+	}
+
+	host_set_keys(keys, n_keys);
+	matharc_main();
+
+	if (frames) {
+		host_gfx_print_frames(stdout);
+		putchar('\n');
+	}
+	host_gfx_print_sites(stdout, max_sites);
+
+	unsigned long mismatches = host_gfx_golden_mismatches();
+	if (mismatches) {
+		fprintf(stderr, "%lu frames differ from the golden images\n",
+			mismatches);
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
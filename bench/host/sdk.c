@@ -0,0 +1,334 @@
+/* Host implementations of the CE toolchain functions declared in include/.
+ * They are just enough to run the game sources natively.
+ */
+
+#include <keypadc.h>
+#include <tice.h>
+#include <compression.h>
+#include <fileioc.h>
+#include <sys/lcd.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "host.h"
+
+uint16_t kb_Data[8];
+
+static const sk_key_t *script;
+static size_t script_len, script_pos;
+
+void host_set_keys(const sk_key_t *keys, size_t n)
+{
+	script = keys;
+	script_len = n;
+	script_pos = 0;
+}
+
+/* Once the script has run out Clear is held down, which leaves every game
+ * and then the program.
+ */
+static sk_key_t next_key(void)
+{
+	return (script_pos < script_len) ? script[script_pos++] : sk_Clear;
+}
+
+/* Each scan takes the next key of the script, so a key is seen as held
+ * down for exactly one scan.
+ */
+void kb_Scan(void)
+{
+	sk_key_t key = next_key();
+
+	memset(kb_Data, 0, sizeof kb_Data);
+	if (key) {
+		// The inverse of the numbering in get_single_key_pressed()
+		kb_Data[7 - (key - 1) / 8] = 1 << ((key - 1) % 8);
+	}
+}
+
+sk_key_t os_GetCSC(void)
+{
+	return next_key();
+}
+
+// As gfx_Begin() leaves the LCD: 8bpp, showing the start of VRAM.
+uint8_t host_lcd_ram[LCD_WIDTH * LCD_HEIGHT * 2];
+uint24_t host_lcd_control = 0x927;
+uintptr_t host_lcd_upbase = (uintptr_t) host_lcd_ram;
+uint8_t host_lcd_int_acknowledge;
+
+/* The new base address is taken at once. 4bpp frames are decoded and shown
+ * through graphx.c; 8bpp ones are graphx's own, which it already showed.
+ */
+uint8_t host_lcd_int_status(void)
+{
+	static uint8_t frame[LCD_HEIGHT][LCD_WIDTH];
+
+	if (host_lcd_int_acknowledge && (host_lcd_control & 0x0e) == 0x04) {
+		const uint8_t *p = (const uint8_t *) host_lcd_upbase;
+		for (int y = 0; y < LCD_HEIGHT; ++y)
+			for (int x = 0; x < LCD_WIDTH; ++x)
+				frame[y][x] = p[y * LCD_WIDTH / 2 + x / 2]
+					>> (x % 2 * 4) & 0xf;
+		host_gfx_show(frame);
+	}
+	host_lcd_int_acknowledge = 0;
+	return 0x04;
+}
+
+// Same size as the calculator's pixel shadow.
+uint8_t host_pixel_shadow[8400];
+
+uint32_t rtc_Time(void)
+{
+	return 0;
+}
+
+// Advanced by usleep() only, see include/time.h.
+static clock_t ticks;
+
+void host_usleep(unsigned long usec)
+{
+	ticks += (unsigned long long) usec * CLOCKS_PER_SEC / 1000000;
+}
+
+clock_t host_clock(void)
+{
+	return ticks;
+}
+
+/* Standard ZX7 decoder, as in Einar Saukas' reference dzx7. */
+struct zx7_reader {
+	const uint8_t *src;
+	uint8_t mask, value;
+};
+
+static int zx7_bit(struct zx7_reader *r)
+{
+	r->mask >>= 1;
+	if (r->mask == 0) {
+		r->mask = 0x80;
+		r->value = *r->src++;
+	}
+	return (r->value & r->mask) != 0;
+}
+
+void zx7_Decompress(void *dst, const void *src)
+{
+	struct zx7_reader r = { src, 0, 0 };
+	uint8_t *out = dst;
+
+	*out++ = *r.src++;
+	for (;;) {
+		if (!zx7_bit(&r)) {
+			*out++ = *r.src++;
+			continue;
+		}
+
+		int bits = 0;
+		while (!zx7_bit(&r))
+			++bits;
+		if (bits > 15)
+			return;
+
+		unsigned length = 1;
+		while (bits--)
+			length = length << 1 | zx7_bit(&r);
+		++length;
+
+		unsigned offset = *r.src++;
+		if (offset & 0x80) {
+			unsigned high = zx7_bit(&r);
+			high = high << 1 | zx7_bit(&r);
+			high = high << 1 | zx7_bit(&r);
+			high = high << 1 | zx7_bit(&r);
+			offset = ((offset & 0x7F) | high << 7) + 0x80;
+		}
+		++offset;
+
+		while (length--) {
+			*out = *(out - offset);
+			++out;
+		}
+	}
+}
+
+/* Standard ZX0 decoder, as in Einar Saukas' reference dzx0. The low bit of
+ * the byte of a new offset is the first bit of the length after it.
+ */
+struct zx0_reader {
+	const uint8_t *src;
+	uint8_t mask, value;
+	bool backtrack;
+};
+
+static int zx0_bit(struct zx0_reader *r)
+{
+	if (r->backtrack) {
+		r->backtrack = false;
+		return r->src[-1] & 1;
+	}
+	r->mask >>= 1;
+	if (r->mask == 0) {
+		r->mask = 0x80;
+		r->value = *r->src++;
+	}
+	return (r->value & r->mask) != 0;
+}
+
+static unsigned zx0_gamma(struct zx0_reader *r, int invert)
+{
+	unsigned value = 1;
+
+	while (!zx0_bit(r))
+		value = value << 1 | (zx0_bit(r) ^ invert);
+	return value;
+}
+
+void zx0_Decompress(void *dst, const void *src)
+{
+	struct zx0_reader r = { src, 0, 0, false };
+	uint8_t *out = dst;
+	unsigned offset = 1, length;
+
+literals:
+	for (length = zx0_gamma(&r, 0); length; --length)
+		*out++ = *r.src++;
+	if (zx0_bit(&r))
+		goto new_offset;
+	for (length = zx0_gamma(&r, 0); length; --length, ++out)
+		*out = *(out - offset);
+	if (!zx0_bit(&r))
+		goto literals;
+new_offset:
+	offset = zx0_gamma(&r, 1);
+	if (offset == 256)
+		return;
+	offset = offset * 128 - (*r.src++ >> 1);
+	r.backtrack = true;
+	for (length = zx0_gamma(&r, 0) + 1; length; --length, ++out)
+		*out = *(out - offset);
+	if (zx0_bit(&r))
+		goto new_offset;
+	goto literals;
+}
+
+/* AppVars kept in memory. A handle is the index of the variable plus one.
+ * The data AppVars are read from HOST_DATA_DIR the first time they are
+ * opened.
+ */
+#define HOST_VARS 16
+#define HOST_VAR_MAX 65512
+
+static struct {
+	char name[9];
+	uint8_t *data;
+	size_t size, pos;
+} vars[HOST_VARS];
+
+uint8_t ti_Open(const char *name, const char *mode)
+{
+	int free_slot = -1;
+	for (int i = 0; i < HOST_VARS; ++i) {
+		if (!vars[i].data) {
+			if (free_slot < 0)
+				free_slot = i;
+		} else if (!strncmp(vars[i].name, name, 8)) {
+			if (mode[0] == 'w')
+				vars[i].size = 0;
+			vars[i].pos = 0;
+			return i + 1;
+		}
+	}
+	if (free_slot < 0)
+		return 0;
+
+	FILE *f = NULL;
+	if (mode[0] == 'r') {
+		char path[256];
+		snprintf(path, sizeof path, "%s/%.8s.bin", HOST_DATA_DIR, name);
+		if (!(f = fopen(path, "rb")))
+			return 0;
+	}
+
+	strncpy(vars[free_slot].name, name, 8);
+	vars[free_slot].data = malloc(HOST_VAR_MAX);
+	vars[free_slot].size = vars[free_slot].pos = 0;
+	if (f) {
+		vars[free_slot].size = fread(vars[free_slot].data, 1,
+			HOST_VAR_MAX, f);
+		fclose(f);
+	}
+	return free_slot + 1;
+}
+
+int ti_Close(uint8_t handle)
+{
+	(void) handle;
+	return 1;
+}
+
+size_t ti_Read(void *data, size_t size, size_t count, uint8_t handle)
+{
+	size_t n = 0;
+	for (; n < count && vars[handle - 1].pos + size <= vars[handle - 1].size;
+		++n) {
+		memcpy((uint8_t *) data + n * size,
+			vars[handle - 1].data + vars[handle - 1].pos, size);
+		vars[handle - 1].pos += size;
+	}
+	return n;
+}
+
+size_t ti_Write(const void *data, size_t size, size_t count, uint8_t handle)
+{
+	size_t n = 0;
+	for (; n < count && vars[handle - 1].pos + size <= HOST_VAR_MAX; ++n) {
+		memcpy(vars[handle - 1].data + vars[handle - 1].pos,
+			(const uint8_t *) data + n * size, size);
+		vars[handle - 1].pos += size;
+	}
+	if (vars[handle - 1].pos > vars[handle - 1].size)
+		vars[handle - 1].size = vars[handle - 1].pos;
+	return n;
+}
+
+int ti_Rewind(uint8_t handle)
+{
+	vars[handle - 1].pos = 0;
+	return 0;
+}
+
+int ti_Delete(const char *name)
+{
+	for (int i = 0; i < HOST_VARS; ++i) {
+		if (vars[i].data && !strncmp(vars[i].name, name, 8)) {
+			free(vars[i].data);
+			vars[i].data = NULL;
+			return 1;
+		}
+	}
+	return 0;
+}
+
+uint16_t ti_GetSize(uint8_t handle)
+{
+	return vars[handle - 1].size;
+}
+
+void *ti_GetDataPtr(uint8_t handle)
+{
+	return vars[handle - 1].data + vars[handle - 1].pos;
+}
+
+bool ti_SetArchiveStatus(bool archived, uint8_t handle)
+{
+	(void) archived;
+	(void) handle;
+	return true;
+}
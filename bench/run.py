@@ -0,0 +1,188 @@
+#!/usr/bin/env python3
+
+"""
+Runs the scripted scenarios in bench/scenarios under CEmu's autotester and
+collects the per-game frame cycle counts printed by a BENCH build (see
+src/bench.h). The results are written to bench/report.json and compared
+against bench/baseline.json. The program also times decoding the built-in
+levels with each codec, and the run fails if they decode to anything but
+the raw levels or if the assembly kernels gave a different result from
+their C versions (see src/bench.c and src/kernels.h).
+
+The autotester needs a ROM image, which is given the same way as for the
+toolchain's own tests:
+    AUTOTESTER_ROM          path to the calculator ROM (required)
+    AUTOTESTER_LIBS_GROUP   path to clibs.8xg (required unless already in ROM)
+    AUTOTESTER              autotester executable (default: autotester)
+"""
+
+import argparse
+import glob
+import json
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+base_path = os.path.dirname(os.path.abspath(__file__))
+
+BENCH_LINE = re.compile(
+    r"BENCH (\w+) frames=(\d+) total=(\d+) max=(\d+)")
+# The checks a BENCH build makes when it starts, by the prefix of its lines.
+CHECKS = ("kernels", "decode")
+CHECK_LINE = r"{}: checked (\w+)=(\d+) mismatches=(\d+)"
+
+REPORT_PATH = os.path.join(base_path, "report.json")
+BASELINE_PATH = os.path.join(base_path, "baseline.json")
+
+
+def autotester_config(scenario, program):
+    """Completes a scenario file with what the autotester needs to run it."""
+    with open(scenario) as f:
+        config = json.load(f)
+
+    # The data AppVars are built next to the program.
+    files = [os.path.abspath(program)] + sorted(
+        glob.glob(os.path.join(os.path.dirname(os.path.abspath(program)),
+                               "*.8xv")))
+    libs = os.environ.get("AUTOTESTER_LIBS_GROUP")
+    if libs:
+        files.insert(0, os.path.abspath(libs))
+
+    config["transfer_files"] = files
+    config["target"] = {
+        "name": os.path.splitext(os.path.basename(program))[0],
+        "isASM": True,
+    }
+    config.setdefault("hashes", {})
+    return config
+
+
+def run_scenario(scenario, program):
+    config = autotester_config(scenario, program)
+    with tempfile.NamedTemporaryFile("w", suffix=".json",
+                                     delete=False) as f:
+        json.dump(config, f)
+        config_path = f.name
+
+    try:
+        result = subprocess.run(
+            [os.environ.get("AUTOTESTER", "autotester"), config_path],
+            stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+            universal_newlines=True)
+    finally:
+        os.remove(config_path)
+
+    for check in CHECKS:
+        summary = re.search(CHECK_LINE.format(check), result.stdout)
+        if not summary:
+            sys.stderr.write(result.stdout)
+            raise RuntimeError(
+                f"{os.path.basename(scenario)}: no {check} check "
+                f"(autotester exited with {result.returncode})")
+        what, n, mismatches = summary.groups()
+        if int(mismatches):
+            for line in result.stdout.splitlines():
+                if line.startswith(check + ":") and line != summary[0]:
+                    print(line)
+            raise RuntimeError(
+                f"{os.path.basename(scenario)}: {check} check failed "
+                f"{mismatches} times in {n} {what}")
+
+    games = {}
+    for match in BENCH_LINE.finditer(result.stdout):
+        name, frames, total, max_ = match.groups()
+        frames, total, max_ = int(frames), int(total), int(max_)
+        if frames == 0:
+            continue
+        games[name] = {
+            "frames": frames,
+            "total_cycles": total,
+            "mean_cycles": total // frames,
+            "max_cycles": max_,
+        }
+
+    if not games:
+        sys.stderr.write(result.stdout)
+        raise RuntimeError(
+            f"{os.path.basename(scenario)}: no BENCH output "
+            f"(autotester exited with {result.returncode})")
+    return games
+
+
+def compare(report, baseline, threshold):
+    """Prints the report next to the baseline and returns the list of
+    scenarios whose mean frame cost grew by more than threshold percent.
+    """
+    regressions = []
+    print(f"{'scenario':<10} {'game':<8} {'frames':>7} "
+          f"{'mean':>10} {'max':>10} {'baseline':>10} {'delta':>8}")
+
+    for scenario, games in sorted(report.items()):
+        for game, stats in sorted(games.items()):
+            old = baseline.get(scenario, {}).get(game)
+            if old:
+                delta = 100.0 * (stats["mean_cycles"] - old["mean_cycles"]) \
+                    / old["mean_cycles"]
+                old_mean, delta_s = str(old["mean_cycles"]), f"{delta:+.1f}%"
+                if delta > threshold:
+                    regressions.append(f"{scenario}/{game}")
+                    delta_s += " !"
+            else:
+                old_mean, delta_s = "-", "-"
+            print(f"{scenario:<10} {game:<8} {stats['frames']:>7} "
+                  f"{stats['mean_cycles']:>10} {stats['max_cycles']:>10} "
+                  f"{old_mean:>10} {delta_s:>8}")
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().split("\n")[0])
+    parser.add_argument("program", help="BENCH build of the program (.8xp)")
+    parser.add_argument("scenarios", nargs="*",
+                        help="scenario files (default: bench/scenarios/*)")
+    parser.add_argument("--threshold", type=float, default=5.0,
+                        help="allowed growth of mean frame cycles in percent")
+    parser.add_argument("--update-baseline", action="store_true",
+                        help="store this run as the new baseline")
+    args = parser.parse_args()
+
+    if "AUTOTESTER_ROM" not in os.environ:
+        sys.exit("AUTOTESTER_ROM must point to a calculator ROM image")
+
+    scenarios = args.scenarios or sorted(
+        glob.glob(os.path.join(base_path, "scenarios", "*.json")))
+
+    report = {}
+    for scenario in scenarios:
+        name = os.path.splitext(os.path.basename(scenario))[0]
+        report[name] = run_scenario(scenario, args.program)
+
+    with open(REPORT_PATH, "w") as f:
+        json.dump(report, f, indent=2, sort_keys=True)
+        f.write("\n")
+
+    if args.update_baseline:
+        with open(BASELINE_PATH, "w") as f:
+            json.dump(report, f, indent=2, sort_keys=True)
+            f.write("\n")
+        print(f"baseline written to {BASELINE_PATH}")
+        return 0
+
+    baseline = {}
+    if os.path.exists(BASELINE_PATH):
+        with open(BASELINE_PATH) as f:
+            baseline = json.load(f)
+    else:
+        print("no baseline yet, run `make bench-baseline` to store one")
+
+    regressions = compare(report, baseline, args.threshold)
+    if regressions:
+        print("frame cost regressed in: " + ", ".join(regressions))
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,103 @@
+#include <stdint.h>
+#include <string.h>
+#include <debug.h>
+
+#include "arena.h"
+
+#ifdef ARENA_GUARD
+/* Every allocation is laid out as its size, the memory handed out and the
+ * guard bytes, so that a release can walk the allocations it gives back.
+ */
+#define GUARD_SIZE 4
+#define GUARD_BYTE 0xa5
+#define OVERHEAD (sizeof(size_t) + GUARD_SIZE)
+#else
+#define OVERHEAD 0
+#endif
+
+static uint8_t pool[ARENA_SIZE];
+
+struct Arena arena = { "arena", pool, sizeof pool, 0, 0 };
+
+void arena_init(struct Arena *a, const char *name, void *mem, size_t size)
+{
+	a->name = name;
+	a->base = mem;
+	a->size = size;
+	a->top = 0;
+	a->high = 0;
+}
+
+/* Returns size bytes of zeroed memory, or NULL if the arena doesn't have
+ * that much left.
+ */
+void *arena_alloc(struct Arena *a, size_t size)
+{
+	if (size > arena_available(a))
+		return NULL;
+
+	uint8_t *p = a->base + a->top;
+#ifdef ARENA_GUARD
+	memcpy(p, &size, sizeof size);
+	p += sizeof size;
+	memset(p + size, GUARD_BYTE, GUARD_SIZE);
+#endif
+	memset(p, 0, size);
+
+	a->top += size + OVERHEAD;
+	if (a->top > a->high)
+		a->high = a->top;
+	return p;
+}
+
+/* The largest allocation that still fits. */
+size_t arena_available(const struct Arena *a)
+{
+	size_t left = a->size - a->top;
+	return (left > OVERHEAD) ? left - OVERHEAD : 0;
+}
+
+/* A checkpoint that arena_release() can roll the arena back to. */
+arena_mark_t arena_mark(const struct Arena *a)
+{
+	return a->top;
+}
+
+/* Frees everything that was allocated after the mark was taken. */
+void arena_release(struct Arena *a, arena_mark_t mark)
+{
+#ifdef ARENA_GUARD
+	for (size_t at = mark; at < a->top; ) {
+		size_t size;
+		memcpy(&size, a->base + at, sizeof size);
+		const uint8_t *guard = a->base + at + sizeof size + size;
+		for (int i = 0; i < GUARD_SIZE; ++i) {
+			if (guard[i] != GUARD_BYTE) {
+				dbg_printf("%s: overrun past the %u bytes at %u\n",
+					a->name, (unsigned) size, (unsigned) at);
+				break;
+			}
+		}
+		at += size + OVERHEAD;
+	}
+#endif
+	a->top = mark;
+}
+
+/* Starts a scope for a game. The high-water mark is measured from here. */
+arena_mark_t arena_scope_begin(struct Arena *a)
+{
+	a->high = a->top;
+	return arena_mark(a);
+}
+
+/* Releases everything the scope allocated and, in debug builds, reports the
+ * most it had allocated at once.
+ */
+void arena_scope_end(struct Arena *a, arena_mark_t mark, const char *name)
+{
+	dbg_printf("%s: %s used at most %u of %u bytes\n", a->name, name,
+		(unsigned) (a->high - mark), (unsigned) (a->size - mark));
+	(void) name;
+	arena_release(a, mark);
+}
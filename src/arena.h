@@ -0,0 +1,51 @@
+/* A bump allocator for the memory the games use while they run.
+ *
+ * Allocations are taken from the top of the arena and given back all at once
+ * by rolling the top back to a mark, so there is no per-allocation bookkeeping
+ * and nothing to free. The menu opens a scope around every game, which is
+ * released when the game returns, so a game can allocate as it pleases and
+ * size its buffers from arena_available().
+ *
+ * With ARENA_GUARD defined (the default in debug builds) every allocation is
+ * followed by guard bytes that are checked when the allocation is released.
+ */
+
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef DEBUG
+#define ARENA_GUARD
+#endif
+
+/* The largest user is Snake with 1.5 KB, the rest is room for new features.
+ * Big buffers that are only needed while the program runs go in scratch RAM
+ * instead, see scratch.h.
+ */
+#define ARENA_SIZE 4096
+
+struct Arena {
+	// Used in the debug output.
+	const char *name;
+	uint8_t *base;
+	size_t size;
+	size_t top;
+	// The highest the top has been since the current scope began.
+	size_t high;
+};
+
+typedef size_t arena_mark_t;
+
+extern struct Arena arena;
+
+void arena_init(struct Arena *a, const char *name, void *mem, size_t size);
+void *arena_alloc(struct Arena *a, size_t size);
+size_t arena_available(const struct Arena *a);
+arena_mark_t arena_mark(const struct Arena *a);
+void arena_release(struct Arena *a, arena_mark_t mark);
+arena_mark_t arena_scope_begin(struct Arena *a);
+void arena_scope_end(struct Arena *a, arena_mark_t mark, const char *name);
+
+#endif // ARENA_H
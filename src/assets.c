@@ -0,0 +1,153 @@
+#include <graphx.h>
+#include <compression.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#include "assets.h"
+#include "scratch.h"
+#include "sprites/gfx.h"
+
+/* The largest set of sprites a single screen uses: the four menu icons.
+ * The Sokoban tiles and player sprites, at both sizes, need less than that.
+ */
+#define ASSET_CACHE_SIZE (sprite_sudoku_size + sprite_sokoban_size \
+	+ sprite_2048_size + sprite_snake_size)
+
+// The size of a sprite of size bytes at half its width and height.
+#define HALF_SIZE(size) (((size) - 2) / 4 + 2)
+
+// How an asset is made.
+enum Derivation {
+	DECODED = 0,
+	MIRRORED,
+	HALVED,
+};
+
+static const struct {
+	const unsigned char *data;
+	uint24_t size;
+	uint8_t how;
+	// The asset a derived one is made from.
+	uint8_t from;
+} sources[N_ASSETS] = {
+	[ASSET_SUDOKU] = {sprite_sudoku_compressed, sprite_sudoku_size},
+	[ASSET_SOKOBAN] = {sprite_sokoban_compressed, sprite_sokoban_size},
+	[ASSET_2048] = {sprite_2048_compressed, sprite_2048_size},
+	[ASSET_SNAKE] = {sprite_snake_compressed, sprite_snake_size},
+	[ASSET_SOKOBAN_WALL] = {sprite_sokoban_wall_compressed,
+		sprite_sokoban_wall_size},
+	[ASSET_SOKOBAN_GOAL] = {sprite_sokoban_goal_compressed,
+		sprite_sokoban_goal_size},
+	[ASSET_SOKOBAN_BOX] = {sprite_sokoban_box_compressed,
+		sprite_sokoban_box_size},
+	[ASSET_SOKOBAN_GOLD_BOX] = {sprite_sokoban_gold_box_compressed,
+		sprite_sokoban_gold_box_size},
+	[ASSET_SOKOBAN_UP] = {sprite_sokoban_up_compressed,
+		sprite_sokoban_up_size},
+	[ASSET_SOKOBAN_DOWN] = {sprite_sokoban_down_compressed,
+		sprite_sokoban_down_size},
+	[ASSET_SOKOBAN_LEFT] = {sprite_sokoban_left_compressed,
+		sprite_sokoban_left_size},
+	[ASSET_SOKOBAN_RIGHT] = {NULL, sprite_sokoban_left_size,
+		MIRRORED, ASSET_SOKOBAN_LEFT},
+	[ASSET_SOKOBAN_WALL_HALF] = {NULL, HALF_SIZE(sprite_sokoban_wall_size),
+		HALVED, ASSET_SOKOBAN_WALL},
+	[ASSET_SOKOBAN_GOAL_HALF] = {NULL, HALF_SIZE(sprite_sokoban_goal_size),
+		HALVED, ASSET_SOKOBAN_GOAL},
+	[ASSET_SOKOBAN_BOX_HALF] = {NULL, HALF_SIZE(sprite_sokoban_box_size),
+		HALVED, ASSET_SOKOBAN_BOX},
+	[ASSET_SOKOBAN_GOLD_BOX_HALF] = {NULL,
+		HALF_SIZE(sprite_sokoban_gold_box_size),
+		HALVED, ASSET_SOKOBAN_GOLD_BOX},
+	[ASSET_SOKOBAN_UP_HALF] = {NULL, HALF_SIZE(sprite_sokoban_up_size),
+		HALVED, ASSET_SOKOBAN_UP},
+	[ASSET_SOKOBAN_DOWN_HALF] = {NULL, HALF_SIZE(sprite_sokoban_down_size),
+		HALVED, ASSET_SOKOBAN_DOWN},
+	[ASSET_SOKOBAN_LEFT_HALF] = {NULL, HALF_SIZE(sprite_sokoban_left_size),
+		HALVED, ASSET_SOKOBAN_LEFT},
+	[ASSET_SOKOBAN_RIGHT_HALF] = {NULL, HALF_SIZE(sprite_sokoban_left_size),
+		HALVED, ASSET_SOKOBAN_RIGHT},
+};
+
+static uint8_t *cache;
+static uint24_t cache_used;
+static gfx_sprite_t *cached[N_ASSETS];
+
+// The cache lives in scratch RAM for as long as the program runs.
+void assets_init(void)
+{
+	cache = arena_alloc(&scratch, ASSET_CACHE_SIZE);
+}
+
+/* Keeps every other pixel of every other row, which is done once so that
+ * drawing at half size is as fast as drawing any other sprite.
+ */
+static void halve(const gfx_sprite_t *src, gfx_sprite_t *dst)
+{
+	uint8_t w = src->width / 2, h = src->height / 2;
+	const uint8_t *p = src->data;
+	uint8_t *q = dst->data;
+
+	dst->width = w;
+	dst->height = h;
+	for (uint8_t y = 0; y < h; ++y, p += src->width) {
+		for (uint8_t x = 0; x < w; ++x, p += 2)
+			*q++ = *p;
+	}
+}
+
+// The room asset id takes in the cache, with whatever it is made from.
+static uint24_t needed(uint8_t id)
+{
+	uint24_t n = 0;
+
+	for (;;) {
+		if (cached[id])
+			return n;
+		n += sources[id].size;
+		if (sources[id].how == DECODED)
+			return n;
+		id = sources[id].from;
+	}
+}
+
+/* Returns the decoded sprite, decoding it first if needed. The pointer stays
+ * valid until the next assets_evict().
+ */
+gfx_sprite_t *asset_get(enum Asset id)
+{
+	if (cached[id])
+		return cached[id];
+
+	// A screen that needs more than the cache holds starts over.
+	if (cache_used + needed(id) > ASSET_CACHE_SIZE)
+		assets_evict();
+
+	// Made before the slot is taken, so the order in the cache holds.
+	gfx_sprite_t *src = NULL;
+	if (sources[id].how != DECODED)
+		src = asset_get(sources[id].from);
+
+	gfx_sprite_t *sprite = (gfx_sprite_t *) &cache[cache_used];
+	cache_used += sources[id].size;
+
+	switch (sources[id].how) {
+	case DECODED:
+		zx7_Decompress(sprite, sources[id].data);
+		break;
+	case MIRRORED:
+		gfx_FlipSpriteY(src, sprite);
+		break;
+	case HALVED:
+		halve(src, sprite);
+		break;
+	}
+	return cached[id] = sprite;
+}
+
+void assets_evict(void)
+{
+	for (int i = 0; i < N_ASSETS; ++i)
+		cached[i] = NULL;
+	cache_used = 0;
+}
@@ -0,0 +1,48 @@
+/* Sprites are stored zx7 compressed and only decoded when a screen first
+ * asks for them. The decoded copies live in a small cache that is emptied
+ * whenever the program switches between the menu and a game, so only the
+ * sprites of the current screen take up RAM.
+ */
+
+#ifndef ASSETS_H
+#define ASSETS_H
+
+#include <graphx.h>
+
+enum Asset {
+	// The menu icons, in the same order as the games in the menu.
+	ASSET_SUDOKU = 0,
+	ASSET_SOKOBAN,
+	ASSET_2048,
+	ASSET_SNAKE,
+
+	ASSET_SOKOBAN_WALL,
+	ASSET_SOKOBAN_GOAL,
+	ASSET_SOKOBAN_BOX,
+	ASSET_SOKOBAN_GOLD_BOX,
+	ASSET_SOKOBAN_UP,
+	ASSET_SOKOBAN_DOWN,
+	ASSET_SOKOBAN_LEFT,
+	// Derived from ASSET_SOKOBAN_LEFT.
+	ASSET_SOKOBAN_RIGHT,
+
+	/* The Sokoban sprites above at half their size, in the same order, for
+	 * the overview of a level. They are derived from the full size ones.
+	 */
+	ASSET_SOKOBAN_WALL_HALF,
+	ASSET_SOKOBAN_GOAL_HALF,
+	ASSET_SOKOBAN_BOX_HALF,
+	ASSET_SOKOBAN_GOLD_BOX_HALF,
+	ASSET_SOKOBAN_UP_HALF,
+	ASSET_SOKOBAN_DOWN_HALF,
+	ASSET_SOKOBAN_LEFT_HALF,
+	ASSET_SOKOBAN_RIGHT_HALF,
+
+	N_ASSETS,
+};
+
+void assets_init(void);
+gfx_sprite_t *asset_get(enum Asset id);
+void assets_evict(void);
+
+#endif // ASSETS_H
@@ -0,0 +1,152 @@
+#ifdef BENCH
+
+#include <sys/timers.h>
+#include <stdint.h>
+#include <string.h>
+#include <debug.h>
+
+#include "bench.h"
+#include "levelpack.h"
+
+/* Timer 1 is left alone because the toolchain's clock() and sleep functions
+ * depend on it.
+ */
+#define BENCH_TIMER 2
+
+static const char *names[BENCH_N_GAMES] = {
+	"sudoku",
+	"sokoban",
+	"2048",
+	"snake",
+};
+
+struct Stats {
+	uint32_t frames, total, max;
+};
+
+static struct Stats stats[BENCH_N_GAMES];
+
+static uint32_t frame_start;
+
+void bench_init(void)
+{
+	timer_Disable(BENCH_TIMER);
+	timer_Set(BENCH_TIMER, 0);
+	timer_Enable(BENCH_TIMER, TIMER_CPU, TIMER_NOINT, TIMER_UP);
+}
+
+/* Marks the beginning of a frame. */
+void bench_mark(void)
+{
+	frame_start = timer_Get(BENCH_TIMER);
+}
+
+static void account(struct Stats *s)
+{
+	uint32_t cycles = timer_Get(BENCH_TIMER) - frame_start;
+
+	++s->frames;
+	s->total += cycles;
+	if (cycles > s->max)
+		s->max = cycles;
+}
+
+/* The format of this line is parsed by bench/run.py */
+static void report(const char *name, struct Stats *s)
+{
+	dbg_printf("BENCH %s frames=%lu total=%lu max=%lu\n", name,
+		s->frames, s->total, s->max);
+	memset(s, 0, sizeof *s);
+}
+
+/* Accounts the cycles since the last bench_mark() as one frame of game. */
+void bench_frame(enum BenchGame game)
+{
+	account(&stats[game]);
+}
+
+void bench_report(enum BenchGame game)
+{
+	report(names[game], &stats[game]);
+}
+
+/* The built-in levels are packed once per codec for `make bench`, in the
+ * packs named here. The raw one is what the others must decode to.
+ */
+static const struct {
+	const char *pack, *name;
+} codecs[] = {
+	[LEVEL_CODEC_RAW] = { "MBRAW", "decode_raw" },
+	[LEVEL_CODEC_ZX7] = { "MBZX7", "decode_zx7" },
+	[LEVEL_CODEC_ZX0] = { "MBZX0", "decode_zx0" },
+	[LEVEL_CODEC_LZ4] = { "MBLZ4", "decode_lz4" },
+	[LEVEL_CODEC_RLE] = { "MBRLE", "decode_rle" },
+};
+
+#define N_CODECS (sizeof codecs / sizeof codecs[0])
+
+/* Times levelpack_cells() on every level of each codec's pack, a level being
+ * a frame, and compares what it decodes to with the raw pack. The zx0
+ * blocks are made by tools/sokpack, so this is what checks them against the
+ * toolchain's decoder. The format of the last line is parsed by
+ * bench/run.py
+ */
+void bench_decode(void)
+{
+	static uint8_t buf[LEVEL_MAX_W * LEVEL_MAX_H];
+	arena_mark_t mark = arena_mark(&arena);
+
+	// Opening a pack archives it, which may move the ones already open.
+	for (uint8_t c = 0; c < N_CODECS; ++c)
+		levelpack_open(&arena, codecs[c].pack);
+	arena_release(&arena, mark);
+
+	const struct LevelPack *raw = levelpack_open(&arena,
+		codecs[LEVEL_CODEC_RAW].pack);
+	unsigned int levels = 0, mismatches = 0;
+
+	if (!raw) {
+		dbg_printf("decode: %s is missing\n",
+			codecs[LEVEL_CODEC_RAW].pack);
+		++mismatches;
+	}
+	for (uint8_t c = 0; raw && c < N_CODECS; ++c) {
+		const struct LevelPack *p = levelpack_open(&arena,
+			codecs[c].pack);
+		struct Stats s = { 0 };
+
+		if (!p || p->index->n_levels != raw->index->n_levels) {
+			dbg_printf("decode: %s is missing\n", codecs[c].pack);
+			++mismatches;
+			continue;
+		}
+		for (uint16_t i = 0; i < p->index->n_levels; ++i) {
+			const struct LevelBlock *b = levelpack_level(p, i);
+			const struct LevelBlock *r = levelpack_level(raw, i);
+			const uint8_t *cells;
+
+			if (!b || !r) {
+				++mismatches;
+				continue;
+			}
+			bench_mark();
+			cells = levelpack_cells(b, buf);
+			// sokpack stores a level raw if the codec would make it bigger.
+			if (b->codec == c)
+				account(&s);
+			++levels;
+			if (!cells || b->w != r->w || b->h != r->h
+				|| memcmp(cells, r->data, r->w * r->h)) {
+				dbg_printf("decode: level %u of %s differs\n", i,
+					codecs[c].pack);
+				++mismatches;
+			}
+		}
+		report(codecs[c].name, &s);
+	}
+	dbg_printf("decode: checked levels=%u mismatches=%u\n", levels,
+		mismatches);
+	arena_release(&arena, mark);
+}
+
+#endif // BENCH
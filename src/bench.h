@@ -0,0 +1,49 @@
+/* Frame cost instrumentation used by `make bench`.
+ *
+ * When BENCH is defined, every frame a game renders is timed with a hardware
+ * timer running at the CPU clock, so the counts are cycles. A summary line is
+ * written to the debug console when the game returns to the menu, which is
+ * where bench/run.py picks it up from CEmu's autotester. In normal builds the
+ * macros expand to nothing.
+ */
+
+#ifndef BENCH_H
+#define BENCH_H
+
+// Must be in the same order as the games in the menu.
+enum BenchGame {
+	BENCH_SUDOKU = 0,
+	BENCH_SOKOBAN,
+	BENCH_2048,
+	BENCH_SNAKE,
+	BENCH_N_GAMES,
+};
+
+#ifdef BENCH
+
+// Fixed seed so that the scripted scenarios always see the same game.
+#define BENCH_SEED 1
+
+void bench_init(void);
+void bench_mark(void);
+void bench_frame(enum BenchGame game);
+void bench_report(enum BenchGame game);
+void bench_decode(void);
+
+#define BENCH_INIT() bench_init()
+#define BENCH_MARK() bench_mark()
+#define BENCH_FRAME(game) bench_frame(game)
+#define BENCH_REPORT(game) bench_report(game)
+#define BENCH_DECODE() bench_decode()
+
+#else
+
+#define BENCH_INIT() ((void) 0)
+#define BENCH_MARK() ((void) 0)
+#define BENCH_FRAME(game) ((void) 0)
+#define BENCH_REPORT(game) ((void) 0)
+#define BENCH_DECODE() ((void) 0)
+
+#endif // BENCH
+
+#endif // BENCH_H
@@ -1,33 +1,6 @@
 #include "common.h"
 #include <keypadc.h>
 
-union Shared share;
-
-/* Searches a buffer for a non-zero value, returning true if there is,
- * or false if the buffer is all zero.
- */
-bool any(const void *p, size_t nmemb, size_t size) {
-	const char *b = p;
-	for (size_t i = 0; i < nmemb * size; ++i) {
-		if (b[i] != 0) {
-			return true;
-		}
-	}
-	return false;
-}
-
-/* Searches a buffer for a non-zero value, returning true if there is,
- * or false if the buffer is all zero.
- */
-bool all(const void *p, size_t nmemb, size_t size) { 
-	for (const void *r = p + nmemb * size; p < r; p += size) {
-		if (!any(p, 1, size)) {
-			return false;
-		}
-	}
-	return true;
-}
-
 // code by jacobly
 uint8_t get_single_key_pressed(void) {
 	static uint8_t last_key;
@@ -57,4 +30,60 @@ int sign(int a) {
 	if (a > 0) return 1;
 	if (a < 0) return -1;
 	return 0;
-}
\ No newline at end of file
+}
+
+struct Rng rng_streams[N_RNG_STREAMS];
+
+/* The finalizer of MurmurHash3, which spreads the seed over all the bits so
+ * that streams from close seeds don't start out alike.
+ */
+static uint32_t mix32(uint32_t x)
+{
+	x ^= x >> 16;
+	x *= 0x85ebca6b;
+	x ^= x >> 13;
+	x *= 0xc2b2ae35;
+	x ^= x >> 16;
+	return x;
+}
+
+/* Seeds every stream from one seed. Each stream starts from a different
+ * multiple of the golden ratio added to the seed.
+ */
+void rng_seed(uint32_t seed)
+{
+	for (uint8_t i = 0; i < N_RNG_STREAMS; ++i) {
+		uint32_t state = mix32(seed + (i + 1) * 0x9e3779b9);
+		rng_streams[i].state = state ? state : 1;
+	}
+}
+
+uint32_t rng_next(struct Rng *rng)
+{
+	uint32_t x = rng->state;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	return rng->state = x;
+}
+
+/* Returns a number in [0, n) for n > 0. Numbers are masked down to the
+ * smallest power of two above n - 1 and the ones that are too large are
+ * drawn again, which keeps them unbiased without a division. Less than half
+ * of the draws are thrown away.
+ */
+uint24_t rng_below(struct Rng *rng, uint24_t n)
+{
+	uint24_t mask = n - 1;
+	mask |= mask >> 1;
+	mask |= mask >> 2;
+	mask |= mask >> 4;
+	mask |= mask >> 8;
+	mask |= mask >> 16;
+
+	uint24_t x;
+	do
+		x = (uint24_t) rng_next(rng) & mask;
+	while (x >= n);
+	return x;
+}
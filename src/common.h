@@ -11,9 +11,19 @@
 
 #include "sprites/gfx.h"
 
-// I'm including this because the union declaration needs to know how much
-// space to allocate for every Sokoban level.
-#include "sokoban_data.h"
+#include "grid.h"
+#include "glyphs.h"
+#include "kernels.h"
+#include "palfx.h"
+#include "lcd4.h"
+#include "levelpack.h"
+#include "levelimport.h"
+#include "arena.h"
+#include "scratch.h"
+#include "snapshot.h"
+#include "modules.h"
+#include "bench.h"
+#include "assets.h"
 
 /* Be wary that SNAKE_PX_STRIDE needs to be at least 2
  * due to an overflow in struct Pos
@@ -31,12 +41,40 @@
 /* This constant is defined from experience. */
 #define CHAR_HEIGHT 8
 
-bool any(const void *, size_t nmemb, size_t size);
-bool all(const void *, size_t nmemb, size_t size);
 int sign(int a);
 uint8_t get_single_key_pressed(void);
+
+/* A xorshift32 generator. Its state is plain data, so saving and restoring
+ * it is a copy. The state must never be 0.
+ */
+struct Rng {
+	uint32_t state;
+};
+
+/* Every game draws from its own stream, so that how many numbers one game
+ * takes doesn't change what another one sees.
+ */
+enum RngStream {
+	RNG_SUDOKU = 0,
+	RNG_2048,
+	RNG_SNAKE,
+	N_RNG_STREAMS,
+};
+
+extern struct Rng rng_streams[N_RNG_STREAMS];
+
+void rng_seed(uint32_t seed);
+uint32_t rng_next(struct Rng *);
+uint24_t rng_below(struct Rng *, uint24_t n);
 void g_list(const char *s[], int x, int y);
+unsigned int g_const_width(const char *s);
 void g_sel(int x, int y);
+void g_layer_begin(void (*draw)(void), uint8_t bg);
+void g_layer_dirty(int x, int y, int width, int height);
+void g_layer_redraw(int x, int y, int width, int height);
+void g_layer_restore(void);
+uint8_t g_buffer(void);
+void g_swap(void);
 
 void snake_mainloop(void);
 void sokoban_mainloop(void);
@@ -73,43 +111,4 @@ enum Colors {
 	G2048_4096,
 };
 
-/* To avoid the overhead for a call like malloc (speed and space), data
- * with non-overlapping lifetimes are merged using a union.
- * A lot of space is saved by sharing memory like this besides the obvious,
- * algorithms can be more wasteful and use less instructions to perform a
- * computation.
- */
-union Shared {
-	struct {
-		struct Pos vertdata[SNAKE_VERTDATA_LEN];
-	} snake_bss;
-
-	struct {
-		uint24_t tiles[_2048_GRID_WH][_2048_GRID_WH];
-	} _2048_bss;
-
-	struct {
-		uint8_t tiles[SUDOKU_GRID_WH][SUDOKU_GRID_WH];
-		uint8_t *tiles_initial;
-		uint24_t curx, cury;
-		bool candidate_set[SUDOKU_GRID_WH][SUDOKU_GRID_WH][10];
-	} sudoku_bss;
-
-	struct {
-		// The order of these fields must be maintained (it is easier
-		// to copy them)
-		// --->
-		uint8_t width, height;
-		uint8_t playerx, playery;
-		// <---
-
-		gfx_sprite_t *player_sprite;
-
-		uint8_t level[SOKOBAN_MAX_LEVEL_SIZE];
-		uint8_t levels[SOKOBAN_LEVELS_SIZE];
-	} sokoban_bss;
-};
-
-extern union Shared share;
-
 #endif // COMMON_H
@@ -1,43 +1,79 @@
 #include <graphx.h>
 #include <tice.h>
 #include <stdbool.h>
-#include <sys/util.h>
 #include <stdio.h>
 #include <string.h>
 
 #include "common.h"
 
-#define tiles share._2048_bss.tiles
+static struct {
+	uint24_t tiles[_2048_GRID_WH][_2048_GRID_WH];
+	// The tile that spawned last, which fades in, or NULL.
+	uint24_t *spawned;
+	// For the light tiles and for the others.
+	const struct Glyphs *dark_glyphs, *light_glyphs;
+} *bss;
+
+#define tiles bss->tiles
+#define spawned bss->spawned
+#define dark_glyphs bss->dark_glyphs
+#define light_glyphs bss->light_glyphs
 #define GRID_LEFT_PADDING (LCD_WIDTH - LCD_HEIGHT)
 #define CELL_WIDTH (LCD_HEIGHT / _2048_GRID_WH)
 #define SCORE_LEFT_PADDING 10
 #define SCORE_TOP_PADDING 90
 #define NUMBER_INSERTED 2
-
-extern union Shared share;
+// With only 2s spawned, no tile can be larger than 2 ** (cells + 1).
+#define MAX_EXPONENT (_2048_GRID_WH * _2048_GRID_WH + 1)
+#define SPAWN_FADE (CLOCKS_PER_SEC / 4)
+// Numbers up to this many digits are drawn twice their size.
+#define BIG_NUMBER_DIGITS 3
 
 static void draw(void);
+static void draw_grid(void);
 static bool spawn_new(void);
 static void rot90(void);
 static int shl_combine(void);
-static bool filternzl(uint24_t row[]);
+static void save_snapshot(uint24_t score);
+static bool load_snapshot(uint24_t *score);
+
+/* The tiles are stored as their exponents, 0 for an empty tile. The
+ * generator is saved too, so a resumed game spawns the same tiles it would
+ * have spawned had it not been left.
+ */
+struct Snapshot {
+	uint8_t exponents[_2048_GRID_WH * _2048_GRID_WH];
+	uint24_t score;
+	struct Rng rng;
+};
 
 void game2048_mainloop(void)
 {
+	if (!(bss = arena_alloc(&arena, sizeof *bss)))
+		return;
 	memset(tiles, 0, sizeof(tiles));
-	spawn_new();
-	spawn_new();
+	if (!(dark_glyphs = glyphs_new(&arena, BLACK))
+		|| !(light_glyphs = glyphs_new(&arena, WHITE)))
+		return;
 
 	uint24_t score = 0;
+	if (!load_snapshot(&score)) {
+		spawn_new();
+		spawn_new();
+	}
 
+	g_layer_begin(draw_grid, WHITE);
+	BENCH_MARK();
 	for (;;) {
 		uint24_t key;
 
 		draw();
-		gfx_SwapDraw();
+		g_swap();
+		BENCH_FRAME(BENCH_2048);
 skip_draw:
 		while (!(key = os_GetCSC()))
-			;
+			palfx_update();
+		BENCH_MARK();
 
 		/* The shift algorithm can be reused by taking advantage of
 		 * identity rotations
@@ -64,6 +100,7 @@ skip_draw:
 			rot90();
 			rot90();
 		} else if (key == sk_Clear) {
+			save_snapshot(score);
 			return;
 		} else {
 			goto skip_draw;
@@ -77,6 +114,8 @@ skip_draw:
 			break;
 	}
 
+	snapshot_discard(G2048_SNAPSHOT);
+
 	draw();
 	gfx_SetTextFGColor(BLACK);
 	gfx_PrintStringXY("Your ", SCORE_LEFT_PADDING, SCORE_TOP_PADDING);
@@ -86,26 +125,44 @@ skip_draw:
 	snprintf(s, sizeof s, "%d", score);
 	gfx_PrintStringXY(s, SCORE_LEFT_PADDING,
 		SCORE_TOP_PADDING + CHAR_HEIGHT * 2);
-	gfx_SwapDraw();
+	g_swap();
 
 	usleep(500000);
 	while (!os_GetCSC())
 		;
 }
 
-static void draw(void)
+/* The grid lines are the background layer. The tiles are drawn inside the
+ * lines, so every frame covers exactly the cells and nothing needs to be
+ * restored.
+ */
+static void draw_grid(void)
 {
-	gfx_FillScreen(WHITE);
+	gfx_SetColor(BLACK);
+	for (int i = 0; i <= 4; ++i) {
+		int v = i * CELL_WIDTH;
+		gfx_HorizLine(GRID_LEFT_PADDING, v, LCD_HEIGHT);
+		gfx_VertLine(GRID_LEFT_PADDING + v, 0, LCD_HEIGHT);
+	}
+}
 
-	int py = 5 + (CELL_WIDTH - 8) / 2;
+static void draw(void)
+{
 	for (int y = 0; y < _2048_GRID_WH; ++y) {
 		for (int x = 0; x < _2048_GRID_WH; ++x) {
 			uint24_t n = tiles[y][x];
-			if (n == 0)
+			if (n == 0) {
+				gfx_SetColor(WHITE);
+				gfx_FillRectangle(
+					x * CELL_WIDTH + GRID_LEFT_PADDING + 1,
+					y * CELL_WIDTH + 1,
+					CELL_WIDTH - 1, CELL_WIDTH - 1
+				);
 				continue;
+			}
 			// 2^24 - 1 = 16,777,215 (8 characters long)
 			char s[8 + 1];
-			snprintf(s, sizeof s, "%d", n);
+			int len = snprintf(s, sizeof s, "%d", n);
 
 			/* __builtin_clz counts the number of leading zeros
 			 * on an unsigned integer. I subtract 1 during the
@@ -120,33 +177,32 @@ static void draw(void)
 			/* 2 or 4 have light backgrounds, so the text needs
 			 * to be black in order to contrast with them.
 			 */
-			gfx_SetTextFGColor((i <= 1) ? BLACK : WHITE);
-			gfx_SetColor(G2048_2 + i);
+			const struct Glyphs *g = (i <= 1) ?
+				dark_glyphs : light_glyphs;
+			gfx_SetColor(&tiles[y][x] == spawned ?
+				PALFX_SLOT_0 : G2048_2 + i);
 
 			gfx_FillRectangle(
-				x * CELL_WIDTH + GRID_LEFT_PADDING, y * CELL_WIDTH,
-				CELL_WIDTH, CELL_WIDTH
+				x * CELL_WIDTH + GRID_LEFT_PADDING + 1,
+				y * CELL_WIDTH + 1,
+				CELL_WIDTH - 1, CELL_WIDTH - 1
 			);
 
-			int px = x * CELL_WIDTH
-				+ GRID_LEFT_PADDING + 5
-				+ (CELL_WIDTH - gfx_GetStringWidth(s)) / 2;
-			gfx_PrintStringXY(s, px, py);
+			uint8_t scale = (len <= BIG_NUMBER_DIGITS) ? 2 : 1;
+			int px = x * CELL_WIDTH + GRID_LEFT_PADDING + 1
+				+ (CELL_WIDTH - 1 - glyphs_width(g, s, scale)) / 2;
+			int py = y * CELL_WIDTH + 1
+				+ (CELL_WIDTH - 1 - GLYPH_SIZE * scale) / 2;
+			glyphs_draw(g, s, px, py, scale);
 		}
-		py += CELL_WIDTH;
-	}
-
-	gfx_SetColor(BLACK);
-	for (int i = 0; i <= 4; ++i) {
-		int v = i * CELL_WIDTH;
-		gfx_HorizLine(GRID_LEFT_PADDING, v, LCD_HEIGHT);
-		gfx_VertLine(GRID_LEFT_PADDING + v, 0, LCD_HEIGHT);
 	}
 }
 
 /* Returns true on success and false on failure */
 static bool spawn_new(void)
 {
+	spawned = NULL;
+
 	/* To avoid an infinite loop, there needs to be a check that it's
 	 * possible to place something on the board (that theres a 0).
 	 */
@@ -154,38 +210,18 @@ static bool spawn_new(void)
 		return false;
 
 	uint24_t *tiles_1d = (uint24_t *) tiles;
-	int24_t pos;
+	uint24_t pos;
 	do
-		pos = randInt(0, _2048_GRID_WH * _2048_GRID_WH - 1);
+		pos = rng_below(&rng_streams[RNG_2048],
+			_2048_GRID_WH * _2048_GRID_WH);
 	while (tiles_1d[pos]);
 
 	tiles_1d[pos] = NUMBER_INSERTED;
+	spawned = &tiles_1d[pos];
+	palfx_fade(PALFX_SLOT_0, WHITE, G2048_2, SPAWN_FADE);
 	return true;
 }
 
-/* Filters non-zero numbers from row and moves them to the beginning (left)
- * of row.
- * Returns true if row was changed and false otherwise.
- */
-static bool filternzl(uint24_t row[])
-{
-	bool changed = false;
-
-	for (int x = 0; x < _2048_GRID_WH - 1; ++x) {
-		if (row[x] == 0) {
-			for (int i = x + 1; i < _2048_GRID_WH; ++i) {
-				if (row[i] != 0) {
-					row[x] = row[i];
-					row[i] = 0;
-					changed = true;
-					break;
-				}
-			}
-		}
-	}
-	return changed;
-}
-
 /* Shifts the tile board left and combines tiles. Score increment
  * is the sum of all tiles involved in combinations.
  *
@@ -196,22 +232,12 @@ static int shl_combine(void)
 	int score_increment = 0;
 	bool changed = false;
 
-	for (int y = 0; y < 4; ++y) {
-		uint24_t *row = tiles[y];
-
-		if (filternzl(row))
+	for (int y = 0; y < _2048_GRID_WH; ++y) {
+		int row_increment = slide_row(tiles[y]);
+		if (row_increment >= 0) {
+			score_increment += row_increment;
 			changed = true;
-
-		for (int x = 0; x < 3 && row[x] != 0; ++x) {
-			if (row[x] == row[x + 1]) {
-				score_increment += (row[x] *= 2);
-				row[x + 1] = 0;
-				changed = true;
-			}
 		}
-
-		if (filternzl(row))
-			changed = true;
 	}
 
 	return (changed) ? score_increment : -1;
@@ -254,3 +280,41 @@ static void rot90(void)
 
 	memcpy(tiles, temp, sizeof temp);
 }
+
+static void save_snapshot(uint24_t score)
+{
+	struct Snapshot snap;
+	uint24_t *tiles_1d = (uint24_t *) tiles;
+
+	for (int i = 0; i < _2048_GRID_WH * _2048_GRID_WH; ++i) {
+		uint24_t n = tiles_1d[i];
+		snap.exponents[i] = n ?
+			8 * sizeof(unsigned int) - 1 - __builtin_clz(n) : 0;
+	}
+	snap.score = score;
+	snap.rng = rng_streams[RNG_2048];
+	snapshot_save(G2048_SNAPSHOT, &snap, sizeof snap);
+}
+
+/* Returns false if there is no game to resume, or if the saved one has a
+ * tile larger than can be made.
+ */
+static bool load_snapshot(uint24_t *score)
+{
+	struct Snapshot snap;
+	uint24_t *tiles_1d = (uint24_t *) tiles;
+
+	if (snapshot_load(G2048_SNAPSHOT, &snap, sizeof snap) != sizeof snap)
+		return false;
+	for (int i = 0; i < _2048_GRID_WH * _2048_GRID_WH; ++i) {
+		if (snap.exponents[i] > MAX_EXPONENT)
+			return false;
+	}
+	for (int i = 0; i < _2048_GRID_WH * _2048_GRID_WH; ++i)
+		tiles_1d[i] = snap.exponents[i] ?
+			(uint24_t) 1 << snap.exponents[i] : 0;
+	*score = snap.score;
+	if (snap.rng.state)
+		rng_streams[RNG_2048] = snap.rng;
+	return true;
+}
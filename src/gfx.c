@@ -14,6 +14,31 @@ void g_list(const char *s[], int x, int y) {
 	}
 }
 
+/* gfx_GetStringWidth() for strings that never change, such as string
+ * literals, which are measured once. Strings are told apart by their address
+ * alone, so a buffer whose contents change must not be passed.
+ */
+#define WIDTH_CACHE_SIZE 8
+
+unsigned int g_const_width(const char *s)
+{
+	static struct {
+		const char *s;
+		unsigned int width;
+	} cache[WIDTH_CACHE_SIZE];
+	static uint8_t next;
+
+	for (uint8_t i = 0; i < WIDTH_CACHE_SIZE; ++i) {
+		if (cache[i].s == s)
+			return cache[i].width;
+	}
+	unsigned int width = gfx_GetStringWidth(s);
+	cache[next].s = s;
+	cache[next].width = width;
+	next = (next + 1) % WIDTH_CACHE_SIZE;
+	return width;
+}
+
 /* An arrow is printed before the ith row stored in listcur */
 void g_sel(int x, int y) {
 	extern int listcur;
@@ -21,3 +46,97 @@ void g_sel(int x, int y) {
 	gfx_PrintStringXY("->", x, y + listcur * CHAR_HEIGHT);
 }
 
+
+/* A static background layer for screens that mostly stay the same between
+ * frames (grid lines, instructions).
+ *
+ * g_layer_begin() renders the layer once into both the buffer and the screen,
+ * after which a frame only needs to draw what moves. Whatever a frame draws
+ * over the layer is reported with g_layer_dirty() and is erased again by
+ * g_layer_restore() before the next frame, by drawing the layer clipped to
+ * the dirty rectangles. As the two buffers alternate, a rectangle is
+ * remembered for both of them. Frames must be shown with g_swap() so that it
+ * is known which buffer is being drawn.
+ */
+
+#define LAYER_MAX_DIRTY 8
+
+struct Rect {
+	int x, y, width, height;
+};
+
+static void (*layer_draw)(void);
+static uint8_t layer_bg;
+static uint8_t layer_buffer;
+
+// n_dirty > LAYER_MAX_DIRTY means that the whole buffer is dirty.
+static struct {
+	uint8_t n_dirty;
+	struct Rect dirty[LAYER_MAX_DIRTY];
+} layer_state[2];
+
+void g_layer_begin(void (*draw)(void), uint8_t bg)
+{
+	layer_draw = draw;
+	layer_bg = bg;
+	layer_buffer = 0;
+	layer_state[0].n_dirty = layer_state[1].n_dirty = 0;
+
+	gfx_FillScreen(bg);
+	draw();
+	gfx_BlitBuffer();
+}
+
+void g_layer_dirty(int x, int y, int width, int height)
+{
+	struct Rect r = { x, y, width, height };
+
+	for (int i = 0; i < 2; ++i) {
+		if (layer_state[i].n_dirty < LAYER_MAX_DIRTY)
+			layer_state[i].dirty[layer_state[i].n_dirty] = r;
+		if (layer_state[i].n_dirty <= LAYER_MAX_DIRTY)
+			++layer_state[i].n_dirty;
+	}
+}
+
+/* Draws the layer over a rectangle without clearing it first, for dynamic
+ * content that goes below the layer.
+ */
+void g_layer_redraw(int x, int y, int width, int height)
+{
+	gfx_SetClipRegion(x, y, x + width, y + height);
+	gfx_SetTextConfig(gfx_text_clip);
+	layer_draw();
+	gfx_SetTextConfig(gfx_text_noclip);
+	gfx_SetClipRegion(0, 0, GFX_LCD_WIDTH, GFX_LCD_HEIGHT);
+}
+
+void g_layer_restore(void)
+{
+	uint8_t n = layer_state[layer_buffer].n_dirty;
+
+	if (n > LAYER_MAX_DIRTY) {
+		gfx_FillScreen(layer_bg);
+		layer_draw();
+	} else {
+		for (uint8_t i = 0; i < n; ++i) {
+			struct Rect *r = &layer_state[layer_buffer].dirty[i];
+			gfx_SetColor(layer_bg);
+			gfx_FillRectangle(r->x, r->y, r->width, r->height);
+			g_layer_redraw(r->x, r->y, r->width, r->height);
+		}
+	}
+	layer_state[layer_buffer].n_dirty = 0;
+}
+
+/* Which of the two buffers is being drawn, 0 right after g_layer_begin() */
+uint8_t g_buffer(void)
+{
+	return layer_buffer;
+}
+
+void g_swap(void)
+{
+	gfx_SwapDraw();
+	layer_buffer ^= 1;
+}
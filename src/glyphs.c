@@ -0,0 +1,58 @@
+#include <graphx.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "glyphs.h"
+
+/* The sprites come from gfx_GetSpriteChar(), which draws in the text colors.
+ * The background is the text background, which is the transparent color
+ * everywhere in the program.
+ */
+struct Glyphs *glyphs_new(struct Arena *a, uint8_t color)
+{
+	struct Glyphs *g = arena_alloc(a, sizeof *g);
+	if (!g)
+		return NULL;
+
+	uint8_t old = gfx_SetTextFGColor(color);
+	for (uint8_t i = 0; i < GLYPHS_N; ++i) {
+		g->width[i] = gfx_GetCharWidth('0' + i);
+		memcpy(g->sprite[i], gfx_GetSpriteChar('0' + i),
+			sizeof g->sprite[i]);
+	}
+	gfx_SetTextFGColor(old);
+	return g;
+}
+
+/* Draws the digit n with its top left corner at x, y, which must be on the
+ * screen as the sprites aren't clipped.
+ */
+void glyphs_digit(const struct Glyphs *g, uint8_t n, int x, int y,
+	uint8_t scale)
+{
+	const gfx_sprite_t *sprite = (const gfx_sprite_t *) g->sprite[n];
+
+	if (scale == 1)
+		gfx_TransparentSprite_NoClip(sprite, x, y);
+	else
+		gfx_ScaledTransparentSprite_NoClip(sprite, x, y, scale, scale);
+}
+
+void glyphs_draw(const struct Glyphs *g, const char *digits, int x, int y,
+	uint8_t scale)
+{
+	for (; *digits; ++digits) {
+		uint8_t n = *digits - '0';
+		glyphs_digit(g, n, x, y, scale);
+		x += g->width[n] * scale;
+	}
+}
+
+unsigned int glyphs_width(const struct Glyphs *g, const char *digits,
+	uint8_t scale)
+{
+	unsigned int width = 0;
+	for (; *digits; ++digits)
+		width += g->width[*digits - '0'];
+	return width * scale;
+}
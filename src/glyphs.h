@@ -0,0 +1,36 @@
+/* Digits rasterized once into sprites.
+ *
+ * gfx_PrintChar() looks a character up in the font and plots it bit by bit
+ * every time it is called, which adds up for the digits Sudoku and 2048 draw
+ * on every frame. A glyph set holds the ten digits in one color as
+ * transparent 8x8 sprites, so drawing one is a single sprite copy, which can
+ * be scaled up for digits that should be easier to read. The set is taken
+ * from an arena and lives as long as the game that made it.
+ */
+
+#ifndef GLYPHS_H
+#define GLYPHS_H
+
+#include <stdint.h>
+
+#include "arena.h"
+
+#define GLYPH_SIZE 8
+#define GLYPHS_N 10
+
+struct Glyphs {
+	// gfx_GetCharWidth() of every digit.
+	uint8_t width[GLYPHS_N];
+	// gfx_sprite_t, followed by its pixels.
+	uint8_t sprite[GLYPHS_N][2 + GLYPH_SIZE * GLYPH_SIZE];
+};
+
+struct Glyphs *glyphs_new(struct Arena *a, uint8_t color);
+void glyphs_digit(const struct Glyphs *g, uint8_t n, int x, int y,
+	uint8_t scale);
+void glyphs_draw(const struct Glyphs *g, const char *digits, int x, int y,
+	uint8_t scale);
+unsigned int glyphs_width(const struct Glyphs *g, const char *digits,
+	uint8_t scale);
+
+#endif // GLYPHS_H
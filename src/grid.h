@@ -0,0 +1,25 @@
+/* Helpers for the games' boards.
+ *
+ * A grid is stored row by row with rows a power of two of cells apart, so
+ * finding a cell is a shift and an add instead of a multiply by a width that
+ * is only known at run time. A bit grid keeps one bit per cell, which is
+ * how flags that would otherwise take a bool each are packed.
+ */
+
+#ifndef GRID_H
+#define GRID_H
+
+#include <stdint.h>
+
+/* The index of the cell at x, y in a grid of 1 << log2_stride cells per row.
+ * An x of -1 or the stride is the cell at the end or start of the row next
+ * to it, like with any other row-major indexing.
+ */
+#define GRID_INDEX(x, y, log2_stride) ((y) * (1 << (log2_stride)) + (x))
+
+#define BITS_BYTES(n) (((n) + 7) / 8)
+#define BITS_GET(bits, i) ((bits)[(i) >> 3] >> ((i) & 7) & 1)
+#define BITS_SET(bits, i) ((bits)[(i) >> 3] |= 1 << ((i) & 7))
+#define BITS_CLEAR(bits, i) ((bits)[(i) >> 3] &= ~(1 << ((i) & 7)))
+
+#endif // GRID_H
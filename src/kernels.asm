@@ -0,0 +1,149 @@
+; eZ80 versions of the routines declared in kernels.h. The C versions in
+; kernels.c are the reference for what each of them returns.
+
+	assume	adl=1
+
+	section	.text
+
+; bool any(const void *p, size_t nmemb, size_t size)
+	public	_any
+_any:
+	ld	iy, 0
+	add	iy, sp
+	ld	hl, (iy + 3)		; p
+	ld	de, (iy + 6)		; nmemb
+.element:
+	push	hl
+	xor	a, a
+	sbc	hl, hl
+	adc	hl, de
+	pop	hl
+	ret	z			; every element is zero
+	ld	bc, (iy + 9)		; size
+.byte:
+	or	a, (hl)
+	jr	nz, .true
+	cpi
+	jp	pe, .byte
+	dec	de
+	jr	.element
+.true:
+	ld	a, 1
+	ret
+
+; bool all(const void *p, size_t nmemb, size_t size)
+	public	_all
+_all:
+	ld	iy, 0
+	add	iy, sp
+	ld	hl, (iy + 3)		; p
+	ld	de, (iy + 6)		; nmemb
+.element:
+	push	hl
+	or	a, a
+	sbc	hl, hl
+	adc	hl, de
+	pop	hl
+	jr	z, .true		; no element is zero
+	ld	bc, (iy + 9)		; size
+	xor	a, a
+.byte:
+	or	a, (hl)
+	cpi
+	jp	pe, .byte
+	or	a, a
+	ret	z			; a = 0
+	dec	de
+	jr	.element
+.true:
+	ld	a, 1
+	ret
+
+; int slide_row(uint24_t row[4])
+;
+; The non-zero tiles are gathered at the start of the row, then the first
+; two equal neighbours are combined, as slide_row_c() does.
+	public	_slide_row
+_slide_row:
+	ld	iy, 0
+	add	iy, sp
+	ld	iy, (iy + 3)		; read pointer
+	lea	de, iy + 0		; write pointer
+	; a collects a bit per tile, set if it isn't zero, under a marker bit
+	; that is shifted to bit 4 after the fourth tile.
+	ld	a, 1
+.gather:
+	ld	bc, (iy + 0)
+	lea	iy, iy + 3
+	or	a, a
+	sbc	hl, hl
+	adc	hl, bc			; leaves carry clear
+	jr	z, .empty
+	ex	de, hl
+	ld	(hl), bc
+	inc	hl
+	inc	hl
+	inc	hl
+	ex	de, hl
+	scf
+.empty:
+	rla
+	bit	4, a
+	jr	z, .gather
+
+	; Clear the tiles after the gathered ones.
+	ld	bc, 0
+.clear:
+	lea	hl, iy + 0
+	or	a, a
+	sbc	hl, de
+	jr	z, .combine
+	ex	de, hl
+	ld	(hl), bc
+	inc	hl
+	inc	hl
+	inc	hl
+	ex	de, hl
+	jr	.clear
+
+.combine:
+	lea	iy, iy - 12
+	ld	b, 3
+.pair:
+	ld	hl, (iy + 3)
+	ld	de, (iy + 0)
+	or	a, a
+	sbc	hl, de
+	jr	nz, .next
+	adc	hl, de			; hl = the tile, carry was clear
+	jr	z, .unchanged_pairs	; the rest of the row is empty
+	add	hl, hl
+	ld	(iy + 0), hl		; hl is returned as the score
+	; Move the tiles after the pair one to the left.
+	dec	b
+	jr	z, .last
+.move:
+	ld	de, (iy + 6)
+	ld	(iy + 3), de
+	lea	iy, iy + 3
+	djnz	.move
+.last:
+	ld	de, 0
+	ld	(iy + 3), de
+	ret
+.next:
+	lea	iy, iy + 3
+	djnz	.pair
+
+.unchanged_pairs:
+	; Gathering moved a tile if a zero came before a non-zero tile, that
+	; is unless the zero bits are the lowest ones.
+	and	a, 15
+	xor	a, 15
+	ld	c, a
+	inc	a
+	and	a, c
+	ld	hl, 0
+	ret	nz
+	dec	hl			; -1, nothing changed
+	ret
@@ -0,0 +1,129 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "common.h"
+
+/* Searches a buffer for a non-zero value, returning true if there is,
+ * or false if the buffer is all zero.
+ */
+bool any_c(const void *p, size_t nmemb, size_t size)
+{
+	const char *b = p;
+	for (size_t i = 0; i < nmemb * size; ++i) {
+		if (b[i] != 0) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/* Returns true if every element of size bytes in the buffer is non-zero,
+ * or false if any of them is zero.
+ */
+bool all_c(const void *p, size_t nmemb, size_t size)
+{
+	for (const char *e = p, *r = e + nmemb * size; e < r; e += size) {
+		if (!any_c(e, 1, size)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/* Filters non-zero numbers from row and moves them to the beginning (left)
+ * of row.
+ * Returns true if row was changed and false otherwise.
+ */
+static bool filternzl(uint24_t row[])
+{
+	bool changed = false;
+
+	for (int x = 0; x < _2048_GRID_WH - 1; ++x) {
+		if (row[x] == 0) {
+			for (int i = x + 1; i < _2048_GRID_WH; ++i) {
+				if (row[i] != 0) {
+					row[x] = row[i];
+					row[i] = 0;
+					changed = true;
+					break;
+				}
+			}
+		}
+	}
+	return changed;
+}
+
+/* Shifts a row of the 2048 board left and combines its tiles. The sum of
+ * the combined tiles is returned, or -1 if the row didn't change.
+ */
+int slide_row_c(uint24_t row[])
+{
+	int score_increment = 0;
+	bool changed = filternzl(row);
+
+	for (int x = 0; x < _2048_GRID_WH - 1 && row[x] != 0; ++x) {
+		if (row[x] == row[x + 1]) {
+			score_increment += (row[x] *= 2);
+			row[x + 1] = 0;
+			changed = true;
+		}
+	}
+
+	if (filternzl(row))
+		changed = true;
+	return (changed) ? score_increment : -1;
+}
+
+#if defined(DEBUG) && defined(KERNELS_ASM)
+
+#include <debug.h>
+
+#define CHECK_ROUNDS 256
+
+static unsigned int mismatches;
+
+static void mismatch(const char *kernel, unsigned int round)
+{
+	dbg_printf("kernels: %s differs from %s_c in round %u\n", kernel,
+		kernel, round);
+	++mismatches;
+}
+
+/* Runs the assembly and the C versions of the kernels on the same random
+ * inputs. The format of the summary line is parsed by bench/run.py
+ */
+void kernels_check(void)
+{
+	struct Rng rng = { 1 };
+	uint8_t buffer[_2048_GRID_WH * _2048_GRID_WH * sizeof(uint24_t)];
+	uint24_t row[_2048_GRID_WH], row_c[_2048_GRID_WH];
+
+	for (unsigned int round = 0; round < CHECK_ROUNDS; ++round) {
+		// Anywhere from none to three quarters of the bytes are zero.
+		uint24_t zeros = rng_below(&rng, 4);
+		for (size_t i = 0; i < sizeof buffer; ++i)
+			buffer[i] = rng_below(&rng, 4) < zeros ?
+				0 : (uint8_t) rng_next(&rng) | 1;
+		size_t size = 1 + rng_below(&rng, sizeof(uint24_t));
+		size_t nmemb = rng_below(&rng, sizeof buffer / size + 1);
+
+		if (any(buffer, nmemb, size) != any_c(buffer, nmemb, size))
+			mismatch("any", round);
+		if (all(buffer, nmemb, size) != all_c(buffer, nmemb, size))
+			mismatch("all", round);
+
+		// Small tiles, so that there are merges.
+		for (int i = 0; i < _2048_GRID_WH; ++i)
+			row[i] = rng_below(&rng, 2) ?
+				0 : (uint24_t) 2 << rng_below(&rng, 3);
+		memcpy(row_c, row, sizeof row);
+		if (slide_row(row) != slide_row_c(row_c)
+			|| memcmp(row, row_c, sizeof row))
+			mismatch("slide_row", round);
+	}
+	dbg_printf("kernels: checked rounds=%u mismatches=%u\n", CHECK_ROUNDS,
+		mismatches);
+}
+
+#endif
@@ -0,0 +1,44 @@
+/* Loops that run on every move, with hand-written eZ80 versions in
+ * kernels.asm.
+ *
+ * The C versions, named with a _c suffix, are the reference and are what
+ * the program uses unless KERNELS_ASM is defined. The assembly is only
+ * turned on by `make bench` until it has been shown to match them: debug
+ * builds with KERNELS_ASM compare it against the C on random inputs when
+ * the program starts and print the result to the debug console, which
+ * bench/run.py fails on if there is any mismatch.
+ */
+
+#ifndef KERNELS_H
+#define KERNELS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+bool any_c(const void *p, size_t nmemb, size_t size);
+bool all_c(const void *p, size_t nmemb, size_t size);
+int slide_row_c(uint24_t row[]);
+
+#ifdef KERNELS_ASM
+
+// size must not be 0.
+bool any(const void *p, size_t nmemb, size_t size);
+bool all(const void *p, size_t nmemb, size_t size);
+int slide_row(uint24_t row[]);
+
+#else
+
+#define any(p, nmemb, size) any_c(p, nmemb, size)
+#define all(p, nmemb, size) all_c(p, nmemb, size)
+#define slide_row(row) slide_row_c(row)
+
+#endif // KERNELS_ASM
+
+#if defined(DEBUG) && defined(KERNELS_ASM)
+void kernels_check(void);
+#else
+#define kernels_check() ((void) 0)
+#endif
+
+#endif // KERNELS_H
@@ -0,0 +1,114 @@
+#include <sys/lcd.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "lcd4.h"
+
+// Two pixels per byte, the left one in the low nibble.
+#define STRIDE (LCD_WIDTH / 2)
+#define FRAME_SIZE (STRIDE * LCD_HEIGHT)
+
+// The bits per pixel field of the control register.
+#define CONTROL_BPP 0x0e
+#define CONTROL_BPP4 0x04
+
+// Raised when the LCD has started showing a new base address.
+#define INT_LNBU 0x04
+
+static struct {
+	bool active;
+	// What graphx had, restored by lcd4_end().
+	uint24_t control;
+	uintptr_t base;
+	// Both frames fit in the graphx buffer that isn't on screen.
+	uint8_t *buffers[2];
+	uint8_t *draw;
+} lcd4;
+
+static void show(uint8_t *frame)
+{
+	lcd_IntAcknowledge = INT_LNBU;
+	lcd_UpBase = (uintptr_t) frame;
+	while (!(lcd_IntStatus & INT_LNBU))
+		;
+}
+
+void lcd4_begin(uint8_t bg)
+{
+	uint8_t fill = bg | bg << 4;
+
+	lcd4.control = lcd_Control;
+	lcd4.base = lcd_UpBase;
+	lcd4.buffers[0] = (uint8_t *) lcd_Ram;
+	if (lcd4.base == (uintptr_t) lcd_Ram)
+		lcd4.buffers[0] += LCD_WIDTH * LCD_HEIGHT;
+	lcd4.buffers[1] = lcd4.buffers[0] + FRAME_SIZE;
+	memset(lcd4.buffers[0], fill, 2 * FRAME_SIZE);
+
+	lcd_Control = (lcd4.control & ~CONTROL_BPP) | CONTROL_BPP4;
+	show(lcd4.buffers[0]);
+	lcd4.draw = lcd4.buffers[1];
+	lcd4.active = true;
+}
+
+void lcd4_end(uint8_t bg)
+{
+	// Cleared while it's hidden, so what was there isn't seen again.
+	memset((uint8_t *) lcd4.base, bg, LCD_WIDTH * LCD_HEIGHT);
+	lcd_Control = lcd4.control;
+	show((uint8_t *) lcd4.base);
+	lcd4.active = false;
+}
+
+bool lcd4_active(void)
+{
+	return lcd4.active;
+}
+
+void lcd4_fill_screen(uint8_t color)
+{
+	memset(lcd4.draw, color | color << 4, FRAME_SIZE);
+}
+
+void lcd4_fill_rect(int x, int y, int width, int height, uint8_t color)
+{
+	if (x < 0) {
+		width += x;
+		x = 0;
+	}
+	if (y < 0) {
+		height += y;
+		y = 0;
+	}
+	if (x + width > LCD_WIDTH)
+		width = LCD_WIDTH - x;
+	if (y + height > LCD_HEIGHT)
+		height = LCD_HEIGHT - y;
+	if (width <= 0 || height <= 0)
+		return;
+
+	uint8_t fill = color | color << 4;
+	uint8_t *row = lcd4.draw + y * STRIDE + x / 2;
+	for (; height > 0; --height, row += STRIDE) {
+		uint8_t *p = row;
+		int n = width;
+
+		// Odd edges share a byte with the pixel next to them.
+		if (x & 1) {
+			*p = (*p & 0x0f) | color << 4;
+			++p;
+			--n;
+		}
+		memset(p, fill, n / 2);
+		if (n & 1)
+			p[n / 2] = (p[n / 2] & 0xf0) | color;
+	}
+}
+
+void lcd4_swap(void)
+{
+	show(lcd4.draw);
+	lcd4.draw = (lcd4.draw == lcd4.buffers[0]) ?
+		lcd4.buffers[1] : lcd4.buffers[0];
+}
@@ -0,0 +1,26 @@
+/* A 4 bits per pixel mode for games that only need a few colors.
+ *
+ * graphx only draws at 8bpp, where every full-screen fill and swap moves
+ * 76800 bytes. Between lcd4_begin() and lcd4_end() the LCD shows 4bpp frames
+ * instead, which take half of that, drawn with the calls below. The colors
+ * are the first 16 entries of the palette, so the games keep their usual
+ * enum Colors values as long as they are below 16.
+ *
+ * graphx must not be used while the mode is on. lcd4_end() leaves the LCD as
+ * graphx had it, with the screen cleared.
+ */
+
+#ifndef LCD4_H
+#define LCD4_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+void lcd4_begin(uint8_t bg);
+void lcd4_end(uint8_t bg);
+bool lcd4_active(void);
+void lcd4_fill_screen(uint8_t color);
+void lcd4_fill_rect(int x, int y, int width, int height, uint8_t color);
+void lcd4_swap(void);
+
+#endif // LCD4_H
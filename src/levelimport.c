@@ -0,0 +1,357 @@
+#include <fileioc.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "grid.h"
+#include "levelimport.h"
+#include "levelpack.h"
+
+#define CHUNK_SIZE 256
+#define MAX_CELLS (LEVEL_MAX_W * LEVEL_MAX_H)
+#define MAX_LEVELS \
+	((LEVELPACK_MAX_SIZE - sizeof(struct LevelPackIndex)) / sizeof(uint32_t))
+#define BLOCK_HEADER_SIZE sizeof(struct LevelBlock)
+
+struct Importer {
+	// The text, a chunk at a time.
+	uint8_t source;
+	uint8_t part;
+	uint16_t chunk_len, chunk_pos;
+	char chunk[CHUNK_SIZE];
+
+	// The size of the level being read. too_big is set if it doesn't fit.
+	uint8_t w, h;
+	bool too_big;
+	uint8_t row_len[LEVEL_MAX_H];
+
+	// The pack being written.
+	const char *pack;
+	uint8_t index, volume;
+	uint8_t n_volumes;
+	uint16_t volume_size;
+	struct LevelImport result;
+
+	/* The level compiled to cells, and room for checking it. Until it is
+	 * compiled, the cells hold the rows as read, LEVEL_MAX_W apart.
+	 */
+	uint8_t block[BLOCK_HEADER_SIZE + MAX_CELLS];
+	uint8_t seen[BITS_BYTES(MAX_CELLS)];
+	uint16_t stack[MAX_CELLS];
+};
+
+bool levelimport_pending(void)
+{
+	char name[10];
+	sprintf(name, LEVELIMPORT_SOURCE, 0);
+	uint8_t handle = ti_Open(name, "r");
+	if (handle)
+		ti_Close(handle);
+	return handle != 0;
+}
+
+/* Returns the next character of the text, going on to the next AppVar at the
+ * end of one, or EOF after the last.
+ */
+static int next_char(struct Importer *im)
+{
+	while (im->chunk_pos == im->chunk_len) {
+		if (!im->source) {
+			char name[10];
+			if (im->part == LEVELPACK_MAX_VOLUMES)
+				return EOF;
+			sprintf(name, LEVELIMPORT_SOURCE, im->part);
+			if (!(im->source = ti_Open(name, "r")))
+				return EOF;
+		}
+		im->chunk_len = ti_Read(im->chunk, 1, CHUNK_SIZE, im->source);
+		im->chunk_pos = 0;
+		if (im->chunk_len == 0) {
+			ti_Close(im->source);
+			im->source = 0;
+			++im->part;
+		}
+	}
+	return (uint8_t) im->chunk[im->chunk_pos++];
+}
+
+/* Reads a line into line, of which only the first LEVEL_MAX_W characters
+ * are kept. Returns its whole length, or -1 at the end of the text.
+ */
+static int read_line(struct Importer *im, char *line)
+{
+	int len = 0;
+	int c;
+
+	while ((c = next_char(im)) != EOF && c != '\n') {
+		if (c == '\r')
+			continue;
+		if (len < LEVEL_MAX_W)
+			line[len] = c;
+		++len;
+	}
+	if (c == EOF && len == 0)
+		return -1;
+	return len;
+}
+
+/* A row of a level only has these and at least one wall. Anything else,
+ * such as titles and comments, ends the level. Only the start of a long line
+ * is kept, which is taken to be a row if it could be one.
+ */
+static bool is_row(const char *line, int len)
+{
+	bool wall = len > LEVEL_MAX_W;
+
+	for (int i = 0; i < len && i < LEVEL_MAX_W; ++i) {
+		if (!strchr("#@+$*. -_", line[i]))
+			return false;
+		wall |= line[i] == '#';
+	}
+	return wall;
+}
+
+static uint8_t cell(char c)
+{
+	switch (c) {
+	case '#':
+		return WALL_BIT;
+	case '$':
+		return BOX_BIT;
+	case '*':
+		return BOX_BIT | GOAL_BIT;
+	case '.':
+	case '+':
+		return GOAL_BIT;
+	default:
+		return 0;
+	}
+}
+
+/* Walks from the player over everything but walls. The level is enclosed if
+ * that never gets to its edge, beyond which is the outside.
+ */
+static bool enclosed(struct Importer *im, const uint8_t *cells,
+	uint8_t px, uint8_t py)
+{
+	uint8_t w = im->w, h = im->h;
+	uint16_t top = 0;
+
+	memset(im->seen, 0, sizeof im->seen);
+	im->stack[top++] = py * w + px;
+	BITS_SET(im->seen, py * w + px);
+	while (top) {
+		uint16_t i = im->stack[--top];
+		uint8_t x = i % w, y = i / w;
+
+		if (x == 0 || y == 0 || x == w - 1 || y == h - 1)
+			return false;
+		const uint16_t next[4] = { i - 1, i + 1, i - w, i + w };
+		for (uint8_t d = 0; d < 4; ++d) {
+			uint16_t j = next[d];
+			if (cells[j] & WALL_BIT || BITS_GET(im->seen, j))
+				continue;
+			BITS_SET(im->seen, j);
+			im->stack[top++] = j;
+		}
+	}
+	return true;
+}
+
+static char *row(struct Importer *im, uint8_t y)
+{
+	return (char *) im->block + BLOCK_HEADER_SIZE + y * LEVEL_MAX_W;
+}
+
+/* Turns the rows into a level block in place. A cell is never written
+ * before the character it is made from has been read, as rows only get
+ * closer together. Returns its size, or 0 if the level isn't playable.
+ */
+static uint16_t compile(struct Importer *im)
+{
+	struct LevelBlock *b = (struct LevelBlock *) im->block;
+	uint8_t *cells = b->data;
+	int n_players = 0, n_boxes = 0, n_goals = 0;
+
+	for (uint8_t y = 0; y < im->h; ++y) {
+		const char *r = row(im, y);
+		for (uint8_t x = 0; x < im->w; ++x, ++cells) {
+			char c = (x < im->row_len[y]) ? r[x] : ' ';
+			if (c == '@' || c == '+') {
+				++n_players;
+				b->player_x = x;
+				b->player_y = y;
+			}
+			*cells = cell(c);
+			n_boxes += !!(*cells & BOX_BIT);
+			n_goals += !!(*cells & GOAL_BIT);
+		}
+	}
+	if (n_players != 1 || n_boxes == 0 || n_boxes != n_goals
+		|| !enclosed(im, b->data, b->player_x, b->player_y))
+		return 0;
+
+	b->codec = LEVEL_CODEC_RAW;
+	b->w = im->w;
+	b->h = im->h;
+	return BLOCK_HEADER_SIZE + im->w * im->h;
+}
+
+/* Closes the volume being written. It is archived so that the next one has
+ * the RAM.
+ */
+static void end_volume(struct Importer *im)
+{
+	ti_SetArchiveStatus(true, im->volume);
+	ti_Close(im->volume);
+	im->volume = 0;
+}
+
+static bool write_level(struct Importer *im, uint16_t size)
+{
+	if (im->volume && im->volume_size + size > LEVELPACK_MAX_SIZE)
+		end_volume(im);
+	if (!im->volume) {
+		char name[10];
+		if (im->n_volumes == LEVELPACK_MAX_VOLUMES)
+			return false;
+		sprintf(name, LEVELPACK_VOLUME, im->pack, im->n_volumes);
+		if (!(im->volume = ti_Open(name, "w")))
+			return false;
+		++im->n_volumes;
+		im->volume_size = 0;
+	}
+
+	uint32_t entry = (uint32_t) (im->n_volumes - 1) << 16
+		| im->volume_size;
+	if (ti_Write(im->block, size, 1, im->volume) != 1
+		|| ti_Write(&entry, sizeof entry, 1, im->index) != 1)
+		return false;
+	im->volume_size += size;
+	++im->result.n_levels;
+	return true;
+}
+
+/* Levels past what the index has room for are skipped. Returns false if the
+ * level was playable but couldn't be written.
+ */
+static bool end_level(struct Importer *im)
+{
+	uint16_t size;
+
+	if (im->too_big || !(size = compile(im))
+		|| im->result.n_levels == MAX_LEVELS)
+		++im->result.n_skipped;
+	else if (!write_level(im, size))
+		return false;
+	im->w = im->h = 0;
+	im->too_big = false;
+	return true;
+}
+
+static void delete_pack(const char *pack)
+{
+	char name[10];
+
+	sprintf(name, LEVELPACK_INDEX, pack);
+	ti_Delete(name);
+	for (uint8_t i = 0; i < LEVELPACK_MAX_VOLUMES; ++i) {
+		sprintf(name, LEVELPACK_VOLUME, pack, i);
+		if (!ti_Delete(name))
+			break;
+	}
+}
+
+static bool import(struct Importer *im,
+	void (*progress)(const struct LevelImport *))
+{
+	char name[10];
+	struct LevelPackIndex header = { LEVELPACK_VERSION, 0, 0 };
+
+	sprintf(name, LEVELPACK_INDEX, im->pack);
+	if (!(im->index = ti_Open(name, "w"))
+		|| ti_Write(&header, sizeof header, 1, im->index) != 1)
+		return false;
+
+	for (;;) {
+		char line[LEVEL_MAX_W];
+		int len = read_line(im, line);
+
+		if (is_row(line, len)) {
+			if (len > LEVEL_MAX_W || im->h == LEVEL_MAX_H) {
+				im->too_big = true;
+				continue;
+			}
+			memcpy(row(im, im->h), line, len);
+			im->row_len[im->h++] = len;
+			if (len > im->w)
+				im->w = len;
+			continue;
+		}
+
+		if (im->h || im->too_big) {
+			if (!end_level(im))
+				return false;
+			if (progress)
+				progress(&im->result);
+		}
+		if (len < 0)
+			break;
+	}
+	if (im->volume)
+		end_volume(im);
+	if (im->result.n_levels == 0)
+		return false;
+
+	header.n_volumes = im->n_volumes;
+	header.n_levels = im->result.n_levels;
+	ti_Rewind(im->index);
+	if (ti_Write(&header, sizeof header, 1, im->index) != 1)
+		return false;
+	ti_SetArchiveStatus(true, im->index);
+	ti_Close(im->index);
+	im->index = 0;
+	return true;
+}
+
+/* Compiles the text into the pack called pack, replacing it. The text is
+ * deleted afterwards, unless nothing could be imported from it, in which case
+ * the pack is deleted instead. progress is called after every level. Returns
+ * false if there were no playable levels or there wasn't enough memory.
+ */
+bool levelimport_run(struct Arena *a, const char *pack,
+	struct LevelImport *result,
+	void (*progress)(const struct LevelImport *))
+{
+	arena_mark_t mark = arena_mark(a);
+	struct Importer *im = arena_alloc(a, sizeof *im);
+	if (!im)
+		return false;
+
+	memset(im, 0, sizeof *im);
+	im->pack = pack;
+	delete_pack(pack);
+	bool ok = import(im, progress);
+	*result = im->result;
+
+	if (im->source)
+		ti_Close(im->source);
+	if (im->volume)
+		ti_Close(im->volume);
+	if (im->index)
+		ti_Close(im->index);
+	arena_release(a, mark);
+
+	if (!ok) {
+		delete_pack(pack);
+		return false;
+	}
+	for (uint8_t i = 0; i < LEVELPACK_MAX_VOLUMES; ++i) {
+		char name[10];
+		sprintf(name, LEVELIMPORT_SOURCE, i);
+		if (!ti_Delete(name))
+			break;
+	}
+	return true;
+}
@@ -0,0 +1,35 @@
+/* Importing Sokoban levels on the calculator.
+ *
+ * Levels can be sent as text in the XSB format of sokoban_levels.txt, in
+ * AppVars called MASOKT00, MASOKT01 and so on, which are read one after the
+ * other as a single file so that a collection can be larger than an AppVar.
+ * levelimport_run() compiles them into a level pack (see levelpack.h). The
+ * text is read a chunk at a time and a level is kept only until it is
+ * written, so the memory needed doesn't depend on the size of the text.
+ *
+ * Levels are checked before they are written: there must be one player, as
+ * many boxes as goals and no way for the player to walk off the level.
+ * Levels that fail or are larger than the game can play are skipped.
+ */
+
+#ifndef LEVELIMPORT_H
+#define LEVELIMPORT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "arena.h"
+
+#define LEVELIMPORT_SOURCE "MASOKT%02u"
+
+struct LevelImport {
+	uint16_t n_levels;
+	uint16_t n_skipped;
+};
+
+bool levelimport_pending(void);
+bool levelimport_run(struct Arena *a, const char *pack,
+	struct LevelImport *result,
+	void (*progress)(const struct LevelImport *));
+
+#endif // LEVELIMPORT_H
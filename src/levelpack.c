@@ -0,0 +1,169 @@
+#include <compression.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "levelpack.h"
+#include "modules.h"
+
+/* Finds the index and the volumes of the pack called name. Returns NULL if
+ * any of them is missing, the index is of another version or too short for
+ * its levels, or there isn't enough room.
+ *
+ * module_data() archives the AppVars it is given, which may move the ones
+ * that are already archived, so all of them are archived before any pointer
+ * is kept.
+ */
+struct LevelPack *levelpack_open(struct Arena *a, const char *name)
+{
+	char index_name[10];
+	sprintf(index_name, LEVELPACK_INDEX, name);
+
+	size_t size;
+	const struct LevelPackIndex *index = module_data(index_name, &size);
+	if (!index || size < sizeof *index
+		|| index->version != LEVELPACK_VERSION
+		|| index->n_levels == 0 || index->n_volumes == 0
+		|| index->n_volumes > LEVELPACK_MAX_VOLUMES
+		|| size < sizeof *index
+			+ index->n_levels * sizeof index->levels[0])
+		return NULL;
+
+	uint8_t n_volumes = index->n_volumes;
+	struct LevelPack *p = arena_alloc(a,
+		sizeof *p + n_volumes * sizeof p->volumes[0]);
+	if (!p)
+		return NULL;
+
+	for (int pass = 0; pass < 2; ++pass) {
+		for (uint8_t i = 0; i < n_volumes; ++i) {
+			char volume_name[10];
+			sprintf(volume_name, LEVELPACK_VOLUME, name, i);
+			p->volumes[i].data = module_data(volume_name,
+				&p->volumes[i].size);
+			if (!p->volumes[i].data)
+				return NULL;
+		}
+	}
+	p->index = module_data(index_name, NULL);
+	return p;
+}
+
+/* Returns level i, which must be below the number of levels, or NULL if its
+ * entry names a volume the pack doesn't have or a place in it without room
+ * for the block's header, or for its cells if they are stored raw. Packs
+ * can be made on the calculator, so these aren't trusted.
+ */
+const struct LevelBlock *levelpack_level(const struct LevelPack *p,
+	uint16_t i)
+{
+	uint32_t entry = p->index->levels[i];
+	if (entry >> 16 >= p->index->n_volumes)
+		return NULL;
+
+	const struct LevelVolume *v = &p->volumes[entry >> 16];
+	size_t at = entry & 0xffff;
+	if (at + sizeof(struct LevelBlock) > v->size)
+		return NULL;
+
+	const struct LevelBlock *b = (const struct LevelBlock *) &v->data[at];
+	if (b->codec == LEVEL_CODEC_RAW
+		&& (size_t) b->w * b->h > v->size - at - sizeof *b)
+		return NULL;
+	return b;
+}
+
+/* Reads a length of LZ4's, which goes on in bytes after a nibble of 15. */
+static size_t lz4_length(const uint8_t **src, size_t len)
+{
+	uint8_t more;
+
+	if (len == 15) {
+		do {
+			more = *(*src)++;
+			len += more;
+		} while (more == 255);
+	}
+	return len;
+}
+
+/* Decodes n bytes in LZ4's block format: each sequence is a token with the
+ * number of literals in its high nibble and the length of the match less 4
+ * in its low one, the literals, and the match's offset, in 16 bits. The last
+ * sequence ends with its literals.
+ *
+ * Nothing is written past the n bytes and no match is copied from before
+ * them, whatever the block holds, so a bad one only makes bad cells.
+ */
+static void lz4_decode(uint8_t *dst, const uint8_t *src, size_t n)
+{
+	uint8_t *start = dst, *end = dst + n;
+
+	while (dst < end) {
+		uint8_t token = *src++;
+		size_t len = lz4_length(&src, token >> 4);
+
+		if (len > (size_t) (end - dst))
+			len = end - dst;
+		memcpy(dst, src, len);
+		dst += len;
+		src += len;
+		if (dst == end)
+			return;
+
+		size_t offset = src[0] | src[1] << 8;
+		src += 2;
+		if (offset == 0 || offset > (size_t) (dst - start))
+			return;
+		const uint8_t *from = dst - offset;
+		len = lz4_length(&src, token & 0xf) + 4;
+		if (len > (size_t) (end - dst))
+			len = end - dst;
+		// The match may overlap what it makes, so it goes a byte at a time.
+		for (; len; --len)
+			*dst++ = *from++;
+	}
+}
+
+// As lz4_decode(), a run that would go past the n bytes is cut short.
+static void rle_decode(uint8_t *dst, const uint8_t *src, size_t n)
+{
+	uint8_t *end = dst + n;
+
+	while (dst < end) {
+		size_t run = (*src >> 4) + 1;
+
+		if (run > (size_t) (end - dst))
+			run = end - dst;
+		memset(dst, *src++ & 0xf, run);
+		dst += run;
+	}
+}
+
+/* Returns the w * h cells of a level. They are decoded into buf, which must
+ * have room for them, unless they are stored as they are, in which case
+ * they are read from the archive. Returns NULL if the block's codec is
+ * unknown.
+ */
+const uint8_t *levelpack_cells(const struct LevelBlock *b, uint8_t *buf)
+{
+	switch (b->codec) {
+	case LEVEL_CODEC_RAW:
+		return b->data;
+	case LEVEL_CODEC_ZX7:
+		zx7_Decompress(buf, b->data);
+		return buf;
+	case LEVEL_CODEC_ZX0:
+		zx0_Decompress(buf, b->data);
+		return buf;
+	case LEVEL_CODEC_LZ4:
+		lz4_decode(buf, b->data, b->w * b->h);
+		return buf;
+	case LEVEL_CODEC_RLE:
+		rle_decode(buf, b->data, b->w * b->h);
+		return buf;
+	default:
+		return NULL;
+	}
+}
@@ -0,0 +1,95 @@
+/* Sokoban level packs.
+ *
+ * A pack is an index AppVar and one or more volume AppVars with the levels.
+ * The levels that come with the game are made by tools/sokpack, others can
+ * be imported on the calculator, see levelimport.h. The index has a 32-bit
+ * entry per level, the volume number in the high half and where the level
+ * starts in that volume in the low half, so finding a level is a lookup
+ * rather than a walk. Every level is a block of its own, compressed on its
+ * own, so a level is decoded straight from the archive without the rest of
+ * the pack ever being in RAM, and a pack can hold as many levels as the
+ * index has room for, not as many as RAM does.
+ */
+
+#ifndef LEVELPACK_H
+#define LEVELPACK_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "arena.h"
+
+#define LEVELPACK_VERSION 1
+
+/* The AppVars of a pack are named after it: the index of pack MASOK is
+ * MASOKDAT and its volumes are MASOKV00, MASOKV01 and so on. A level never
+ * straddles two volumes.
+ */
+#define LEVELPACK_INDEX "%.5sDAT"
+#define LEVELPACK_VOLUME "%.5sV%02u"
+#define LEVELPACK_MAX_VOLUMES 100
+#define LEVELPACK_BUILTIN "MASOK"
+#define LEVELPACK_IMPORTED "MAIMP"
+
+// The most an AppVar can hold.
+#define LEVELPACK_MAX_SIZE 65505
+
+// The largest level the game can play.
+#define LEVEL_MAX_W 30
+#define LEVEL_MAX_H 30
+
+/* How the cells of a level block are stored. tools/sokpack picks whichever
+ * makes a level smallest, and -s shows how each would do on a pack.
+ *  - zx7 and zx0 are decoded by the toolchain's routines,
+ *  - LZ4 is its block format, which copies whole runs and so decodes fast,
+ *  - RLE is a byte per run of up to 16 cells, the length less 1 in the high
+ *    nibble and the cell in the low one, as cells only take a nibble.
+ */
+enum LevelCodec {
+	LEVEL_CODEC_RAW = 0,
+	LEVEL_CODEC_ZX7,
+	LEVEL_CODEC_ZX0,
+	LEVEL_CODEC_LZ4,
+	LEVEL_CODEC_RLE,
+};
+
+// The layout of the index AppVar.
+struct LevelPackIndex {
+	uint8_t version;
+	uint8_t n_volumes;
+	uint16_t n_levels;
+	uint32_t levels[];
+};
+
+// The flags of a cell. A cell without any is floor.
+#define BOX_BIT  0b1000
+#define GOAL_BIT 0b0100
+#define WALL_BIT 0b0010
+
+/* The layout of a level in a volume. The cells are w * h bytes of flags row
+ * by row, stored as the codec says.
+ */
+struct LevelBlock {
+	uint8_t codec;
+	uint8_t w, h;
+	uint8_t player_x, player_y;
+	uint8_t data[];
+};
+
+struct LevelVolume {
+	const uint8_t *data;
+	size_t size;
+};
+
+struct LevelPack {
+	const struct LevelPackIndex *index;
+	struct LevelVolume volumes[];
+};
+
+struct LevelPack *levelpack_open(struct Arena *a, const char *name);
+const struct LevelBlock *levelpack_level(const struct LevelPack *p,
+	uint16_t i);
+const uint8_t *levelpack_cells(const struct LevelBlock *b, uint8_t *buf);
+
+#endif // LEVELPACK_H
@@ -11,25 +11,38 @@
 
 static inline void palette_init(void);
 static void selection_screen(void);
+static void draw_menu(void);
 
-/* must be null-terminated */
-const char *list_items[] = {
-	"sudoku",
-	"sokoban",
-	"2048",
-	"snake",
-	NULL
+static const char *msgs[] = {
+	"a) Use the up and down arrow",
+	"keys to control the cursor.",
+	"b) Press 2nd to boot the game.",
+	"c) To exit, press Clear.",
+	"d) Use arrow keys for movement.",
+	"Also, Sudoku uses numpad. You",
+	"can only place stuff if you're",
+	"allowed to in that cell. FYI.",
+	"e) Del forgets a saved game.",
+	NULL,
 };
 
-#define N_GAMES (sizeof(list_items) / sizeof(list_items[0]) - 1)
-
 int main(void) {
-	srandom(rtc_Time());
+#ifdef BENCH
+	rng_seed(BENCH_SEED);
+	BENCH_INIT();
+#else
+	rng_seed(rtc_Time());
+#endif
+	kernels_check();
+	BENCH_DECODE();
+	scratch_claim();
+	assets_init();
 	gfx_Begin();
 	gfx_SetDrawBuffer();
 	palette_init();
 	selection_screen();
 	gfx_End();
+	scratch_return();
 }
 
 /* Initializes the palette using the pre-generated array created by convimg.
@@ -49,45 +62,31 @@ static inline void palette_init(void) {
 static void selection_screen(void) {
 	extern int listcur;
 
-	const char *msgs[] = {
-		"a) Use the up and down arrow",
-		"keys to control the cursor.",
-		"b) Press 2nd to boot the game.",
-		"c) To exit, press Clear.",
-		"d) Use arrow keys for movement.",
-		"Also, Sudoku uses numpad. You",
-		"can only place stuff if you're",
-		"allowed to in that cell. FYI.",
-		NULL,
-	};
-
-	// The image to be displayed by when a user hovers over the icon.
-	const gfx_sprite_t *sprites[N_GAMES] = {
-		sprite_sudoku,
-		sprite_sokoban,
-		sprite_2048,
-		sprite_snake,
-	};
+	/* The sprite that each buffer shows. All the sprites have the same
+	 * size and no transparency, so a new one covers the old one.
+	 */
+	int shown[2];
 
-	void (*gameloops[N_GAMES])(void) = {
-		sudoku_mainloop,
-		sokoban_mainloop,
-		game2048_mainloop,
-		snake_mainloop,
-	};
+	g_layer_begin(draw_menu, WHITE);
+	shown[0] = shown[1] = -1;
 
 	for (;;) {
-		gfx_FillScreen(WHITE);
-		g_list(list_items, MENU_LEFT_PADDING, MENU_TOP_PADDING);
+		g_layer_restore();
 		g_sel(MENU_LEFT_PADDING - MENU_CURSOR_WIDTH, MENU_TOP_PADDING);
-		gfx_SetTextFGColor(BLUE);
-		g_list(msgs, LCD_WIDTH - gfx_GetStringWidth(msgs[4]) - MENU_LEFT_PADDING, MENU_TOP_PADDING);
-		gfx_ScaledSprite_NoClip(
-			sprites[listcur],
-			LCD_WIDTH / 2 - sprites[listcur]->width * 2, LCD_HEIGHT - sprites[listcur]->height*4,
-			4, 4
-		);
-		gfx_SwapDraw();
+		g_layer_dirty(MENU_LEFT_PADDING - MENU_CURSOR_WIDTH,
+			MENU_TOP_PADDING + listcur * CHAR_HEIGHT,
+			MENU_CURSOR_WIDTH, CHAR_HEIGHT);
+		if (shown[g_buffer()] != listcur) {
+			const gfx_sprite_t *icon =
+				asset_get(modules[listcur].icon);
+			gfx_ScaledSprite_NoClip(
+				icon,
+				LCD_WIDTH / 2 - icon->width * 2, LCD_HEIGHT - icon->height*4,
+				4, 4
+			);
+			shown[g_buffer()] = listcur;
+		}
+		g_swap();
 
 		int key;
 		while (!(key = os_GetCSC()))
@@ -99,16 +98,48 @@ static void selection_screen(void) {
 			++listcur;
 		} else if (key == sk_Clear) {
 			return;
+		} else if (key == sk_Del) {
+			snapshot_discard(modules[listcur].snapshot);
+			continue;
 		} else if (key == sk_2nd) {
-			gameloops[listcur]();
+			if (!module_available(&modules[listcur]))
+				continue;
+
+			// Each screen only keeps its own sprites decoded.
+			assets_evict();
+			arena_mark_t scope = arena_scope_begin(&arena);
+			arena_mark_t scratch_scope = arena_scope_begin(&scratch);
+			modules[listcur].mainloop();
+			arena_scope_end(&scratch, scratch_scope,
+				modules[listcur].name);
+			arena_scope_end(&arena, scope, modules[listcur].name);
+			assets_evict();
+			palfx_stop();
+			BENCH_REPORT(listcur);
+			g_layer_begin(draw_menu, WHITE);
+			shown[0] = shown[1] = -1;
 		} else {
 			continue;
 		}
 
 		if (listcur < 0) {
-			listcur = N_GAMES - 1;
-		} else if (listcur >= (int) N_GAMES) {
+			listcur = N_MODULES - 1;
+		} else if (listcur >= N_MODULES) {
 			listcur = 0;
 		}
 	}
 }
+
+/* Everything on the menu except for the cursor and the game's sprite */
+static void draw_menu(void)
+{
+	// Games whose data isn't on the calculator are grayed out.
+	for (int i = 0; i < N_MODULES; ++i) {
+		gfx_SetTextFGColor(module_available(&modules[i]) ?
+			BLACK : GRAY1);
+		gfx_PrintStringXY(modules[i].name, MENU_LEFT_PADDING,
+			MENU_TOP_PADDING + i * CHAR_HEIGHT);
+	}
+	gfx_SetTextFGColor(BLUE);
+	g_list(msgs, LCD_WIDTH - g_const_width(msgs[4]) - MENU_LEFT_PADDING, MENU_TOP_PADDING);
+}
@@ -0,0 +1,42 @@
+#include <fileioc.h>
+#include <stddef.h>
+
+#include "common.h"
+
+const struct Module modules[N_MODULES] = {
+	{ "sudoku", ASSET_SUDOKU, sudoku_mainloop, SUDOKU_SNAPSHOT,
+		SUDOKU_DATA },
+	{ "sokoban", ASSET_SOKOBAN, sokoban_mainloop, SOKOBAN_SNAPSHOT,
+		SOKOBAN_DATA },
+	{ "2048", ASSET_2048, game2048_mainloop, G2048_SNAPSHOT, NULL },
+	{ "snake", ASSET_SNAKE, snake_mainloop, SNAKE_SNAPSHOT, NULL },
+};
+
+/* Returns the contents of a data AppVar, or NULL if it isn't on the
+ * calculator, and its size in size unless that is NULL. The AppVar is
+ * archived first, so the pointer is into flash and stays valid until
+ * something is archived or garbage collected, which the games only do on
+ * their way back to the menu.
+ */
+const void *module_data(const char *name, size_t *size)
+{
+	uint8_t handle = ti_Open(name, "r");
+	if (!handle)
+		return NULL;
+	ti_SetArchiveStatus(true, handle);
+	const void *data = ti_GetDataPtr(handle);
+	if (size)
+		*size = ti_GetSize(handle);
+	ti_Close(handle);
+	return data;
+}
+
+bool module_available(const struct Module *module)
+{
+	if (!module->data)
+		return true;
+	uint8_t handle = ti_Open(module->data, "r");
+	if (handle)
+		ti_Close(handle);
+	return handle != 0;
+}
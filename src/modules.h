@@ -0,0 +1,37 @@
+/* The registry of the games on the menu.
+ *
+ * A game's bulky data, such as the Sudoku boards or the Sokoban level pack,
+ * ships as archived AppVars of its own next to the program (see data/ and
+ * the makefile). It is read in place from flash when the game starts, so new
+ * boards or levels don't grow MATHARC, and a game whose AppVar is missing is
+ * shown grayed out instead of failing.
+ */
+
+#ifndef MODULES_H
+#define MODULES_H
+
+#include <stdbool.h>
+
+#include "assets.h"
+
+#define SUDOKU_DATA "MASUDDAT"
+#define SOKOBAN_DATA "MASOKDAT"
+
+struct Module {
+	const char *name;
+	enum Asset icon;
+	void (*mainloop)(void);
+	// The AppVar the game keeps its snapshot in.
+	const char *snapshot;
+	// The AppVar with the game's data, or NULL if it has none.
+	const char *data;
+};
+
+// In the order of the menu, which is also the order of enum BenchGame.
+#define N_MODULES 4
+extern const struct Module modules[N_MODULES];
+
+const void *module_data(const char *name, size_t *size);
+bool module_available(const struct Module *module);
+
+#endif // MODULES_H
@@ -0,0 +1,122 @@
+#include <graphx.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#include "palfx.h"
+
+// The number of steps from one color to the other.
+#define STEPS 32
+
+enum Kind {
+	OFF = 0,
+	// From one color to the other, then stays there.
+	FADE,
+	// From one color to the other and back, forever.
+	PULSE,
+};
+
+static struct Effect {
+	uint8_t kind;
+	// The last step written to the palette.
+	uint8_t step;
+	uint16_t from, to;
+	clock_t start, duration;
+	// Steps per tick in 16.16 fixed point, so updating doesn't divide.
+	uint32_t rate;
+} effects[PALFX_N_SLOTS];
+
+/* Mixes two 1555 colors, step out of STEPS of the way from a to b. The top
+ * bit is the low bit of green, which is taken from the closer color.
+ */
+static uint16_t mix(uint16_t a, uint16_t b, uint8_t step)
+{
+	uint16_t c = (step < STEPS / 2 ? a : b) & 0x8000;
+	for (uint8_t shift = 0; shift < 15; shift += 5) {
+		int ca = a >> shift & 0x1f;
+		int cb = b >> shift & 0x1f;
+		c |= (ca + (cb - ca) * step / STEPS) << shift;
+	}
+	return c;
+}
+
+static void start(uint8_t slot, uint8_t kind, uint8_t from, uint8_t to,
+	clock_t duration)
+{
+	struct Effect *e = &effects[slot - PALFX_SLOT_0];
+
+	e->kind = kind;
+	e->step = 0;
+	e->from = gfx_palette[from];
+	e->to = gfx_palette[to];
+	e->start = clock();
+	e->duration = duration;
+	e->rate = duration ? ((uint32_t) STEPS << 16) / duration : 0;
+	gfx_palette[slot] = e->from;
+}
+
+/* Turns the slot from one palette color into another over duration ticks
+ * of clock().
+ */
+void palfx_fade(uint8_t slot, uint8_t from, uint8_t to, clock_t duration)
+{
+	start(slot, FADE, from, to, duration);
+}
+
+/* Turns the slot from one palette color into another and back every
+ * period ticks until it's stopped.
+ */
+void palfx_pulse(uint8_t slot, uint8_t from, uint8_t to, clock_t period)
+{
+	start(slot, PULSE, from, to, period / 2);
+}
+
+// Shows flash in the slot, which then fades back to color.
+void palfx_flash(uint8_t slot, uint8_t color, uint8_t flash,
+	clock_t duration)
+{
+	start(slot, FADE, flash, color, duration);
+}
+
+void palfx_update(void)
+{
+	clock_t now = clock();
+
+	for (uint8_t i = 0; i < PALFX_N_SLOTS; ++i) {
+		struct Effect *e = &effects[i];
+		if (e->kind == OFF)
+			continue;
+
+		// Pulses start over every period, which keeps the product below
+		// from overflowing.
+		if (e->kind == PULSE && e->duration) {
+			while (now - e->start >= 2 * e->duration)
+				e->start += 2 * e->duration;
+		}
+
+		uint32_t steps = e->rate ?
+			(uint32_t) (now - e->start) * e->rate >> 16 : STEPS;
+		uint8_t step;
+		if (e->kind == FADE) {
+			step = steps < STEPS ? steps : STEPS;
+			if (step == STEPS)
+				e->kind = OFF;
+		} else {
+			step = steps;
+			if (step > STEPS)
+				step = 2 * STEPS - step;
+		}
+
+		if (step != e->step) {
+			e->step = step;
+			gfx_palette[PALFX_SLOT_0 + i] = mix(e->from, e->to, step);
+		}
+	}
+}
+
+// Effects left running by a game are stopped by the menu.
+void palfx_stop(void)
+{
+	memset(effects, 0, sizeof effects);
+}
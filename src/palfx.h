@@ -0,0 +1,34 @@
+/* Palette effects.
+ *
+ * The last few palette entries are kept out of the sprite palette and their
+ * colors are animated instead: whatever is drawn with one of them pulses,
+ * fades or flashes without being drawn again, for the cost of rewriting a
+ * 2 byte palette entry. The effects follow clock(), so palfx_update() never
+ * waits and can be called from any loop, such as the ones waiting for a
+ * key.
+ */
+
+#ifndef PALFX_H
+#define PALFX_H
+
+#include <stdint.h>
+#include <time.h>
+
+#define PALFX_N_SLOTS 4
+
+// Palette entries to draw with. Their color is whatever the effect says.
+enum PalfxSlot {
+	PALFX_SLOT_0 = 256 - PALFX_N_SLOTS,
+	PALFX_SLOT_1,
+	PALFX_SLOT_2,
+	PALFX_SLOT_3,
+};
+
+void palfx_fade(uint8_t slot, uint8_t from, uint8_t to, clock_t duration);
+void palfx_pulse(uint8_t slot, uint8_t from, uint8_t to, clock_t period);
+void palfx_flash(uint8_t slot, uint8_t color, uint8_t flash,
+	clock_t duration);
+void palfx_update(void);
+void palfx_stop(void);
+
+#endif // PALFX_H
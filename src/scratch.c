@@ -0,0 +1,23 @@
+#include <tice.h>
+#include <string.h>
+
+#include "scratch.h"
+
+/* The pixel shadow is the only spare region worth having: the shadows that
+ * follow it hold the program's BSS and heap, and both 8bpp buffers fill the
+ * whole of VRAM.
+ */
+#define SCRATCH_SIZE 8400
+
+struct Arena scratch;
+
+void scratch_claim(void)
+{
+	arena_init(&scratch, "scratch", os_PixelShadow, SCRATCH_SIZE);
+}
+
+// The OS expects to get the pixel shadow back cleared.
+void scratch_return(void)
+{
+	memset(os_PixelShadow, 0, SCRATCH_SIZE);
+}
@@ -0,0 +1,20 @@
+/* Large buffers that are only needed while the program runs are placed in
+ * RAM that the OS lends to programs, rather than in the program's own BSS.
+ *
+ * The contract with the OS: scratch_claim() is called once at startup, and
+ * scratch_return() clears the memory again right before the program exits.
+ * Nothing in between may call OS routines that draw graphs, since those are
+ * what the OS uses the memory for.
+ */
+
+#ifndef SCRATCH_H
+#define SCRATCH_H
+
+#include "arena.h"
+
+extern struct Arena scratch;
+
+void scratch_claim(void);
+void scratch_return(void);
+
+#endif // SCRATCH_H
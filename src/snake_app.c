@@ -3,11 +3,17 @@
 #include <keypadc.h>
 #include <sys/timers.h>
 #include <stdio.h>
+#include <stddef.h>
+#include <string.h>
 #include <debug.h>
 
 #include "common.h"
 
-#define vertdata share.snake_bss.vertdata
+static struct {
+	struct Pos vertdata[SNAKE_VERTDATA_LEN];
+} *bss;
+
+#define vertdata bss->vertdata
 
 #define FOOD_VALUE 1
 #define SNAKE_COLOR BLACK
@@ -40,8 +46,24 @@ static bool collcheck(struct Snake, struct Pos vert);
 static struct Pos random_vert(void);
 static void draw_snake(struct Snake);
 static void draw_food(struct Pos);
+static void fill_rect(int x, int y, int width, int height, uint8_t color);
 static void keep_lte(uint8_t *, uint8_t *);
 static bool iteredges(struct Snake snake, struct Pos *dp1, struct Pos *dp2);
+static void save_snapshot(struct Snake snake, struct Pos food, uint24_t score,
+	uint24_t tail_growth, enum LookDir head_dir);
+static bool load_snapshot(struct Snake *snake, struct Pos *food,
+	uint24_t *score, uint24_t *tail_growth, enum LookDir *head_dir);
+
+/* Only as many vertices as the snake has are saved. */
+struct Snapshot {
+	struct Rng rng;
+	struct Pos food;
+	uint24_t score, tail_growth;
+	uint8_t head_dir;
+	uint24_t n_verts;
+	// From the tail to the head.
+	struct Pos verts[SNAKE_VERTDATA_LEN];
+};
 
 void snake_mainloop(void)
 {
@@ -50,19 +72,43 @@ void snake_mainloop(void)
 	uint24_t score, tail_growth;
 	enum LookDir head_dir;
 
-	snake.tail = &vertdata[0];
-	snake.head = &vertdata[1];
-	score = 0;
-	tail_growth = 0;
+	if (!(bss = arena_alloc(&arena, sizeof *bss)))
+		return;
 
-	*snake.head = *snake.tail = random_vert();
-	// I'm doing this to give the player some time to react
-	head_dir = (snake.head->x < SNAKE_GRID_WIDTH / 2) ? D_RIGHT : D_LEFT;
+	// The game only has a few colors, so it's drawn at 4bpp until it ends.
+	lcd4_begin(WHITE);
 
-	// Done to avoid repetitive logic
-	food = *snake.head;
+	if (load_snapshot(&snake, &food, &score, &tail_growth, &head_dir)) {
+		// The game waits for a key to start moving again.
+		lcd4_fill_screen(WHITE);
+		draw_snake(snake);
+		draw_food(food);
+		lcd4_swap();
+
+		uint8_t key;
+		while (!(key = os_GetCSC()))
+			;
+		if (key == sk_Clear) {
+			lcd4_end(WHITE);
+			return;
+		}
+	} else {
+		snake.tail = &vertdata[0];
+		snake.head = &vertdata[1];
+		score = 0;
+		tail_growth = 0;
+
+		*snake.head = *snake.tail = random_vert();
+		// I'm doing this to give the player some time to react
+		head_dir = (snake.head->x < SNAKE_GRID_WIDTH / 2) ?
+			D_RIGHT : D_LEFT;
+
+		// Done to avoid repetitive logic
+		food = *snake.head;
+	}
 
 	for (;;) {
+		BENCH_MARK();
 		if (snake.head->x == food.x && snake.head->y == food.y) {
 			do
 				food = random_vert();
@@ -77,10 +123,10 @@ void snake_mainloop(void)
 			score += FOOD_VALUE;
 		}
 
-		gfx_FillScreen(WHITE);
+		lcd4_fill_screen(WHITE);
 		draw_snake(snake);
 		draw_food(food);
-		gfx_SwapDraw();
+		lcd4_swap();
 
 		uint8_t key = get_single_key_pressed();
 		enum LookDir prev_dir = head_dir;
@@ -103,6 +149,8 @@ void snake_mainloop(void)
 				head_dir = D_DOWN;
 			break;
 		case sk_Clear:
+			save_snapshot(snake, food, score, tail_growth, head_dir);
+			lcd4_end(WHITE);
 			return;
 		}
 
@@ -135,15 +183,21 @@ void snake_mainloop(void)
 		else
 			move_tail(&snake);
 
+		BENCH_FRAME(BENCH_SNAKE);
 		usleep(SNAKE_UWAIT);
 	}
 
+	snapshot_discard(SNAKE_SNAPSHOT);
+
+	// The score and the blinking head are drawn with graphx again.
+	lcd4_end(WHITE);
 	gfx_FillScreen(WHITE);
 	draw_snake(snake);
-	gfx_SetColor(RED);
-	gfx_FillRectangle(
+	// The head blinks until a key is pressed.
+	palfx_pulse(PALFX_SLOT_0, RED, WHITE, CLOCKS_PER_SEC);
+	fill_rect(
 		snake.head->x * SNAKE_PX_STRIDE, snake.head->y * SNAKE_PX_STRIDE,
-		SNAKE_PX_STRIDE, SNAKE_PX_STRIDE
+		SNAKE_PX_STRIDE, SNAKE_PX_STRIDE, PALFX_SLOT_0
 	);
 
 	// "SCORE: " (7 chars) + score (8 chars) + '\0' (1 char) = 16
@@ -159,41 +213,52 @@ void snake_mainloop(void)
 	usleep(500000);
 
 	while (!os_GetCSC())
-		;
+		palfx_update();
 }
 
 /* Draw the snake's vertices by connecting them */
 static void draw_snake(struct Snake snake)
 {
-	gfx_SetColor(SNAKE_COLOR);
-
 	struct Pos p1, p2;
 
 	iteredges(snake, NULL, NULL);
 	while (iteredges(snake, &p1, &p2)) {
-		gfx_FillRectangle(
+		fill_rect(
 			p1.x * SNAKE_PX_STRIDE, p1.y * SNAKE_PX_STRIDE,
 			(p2.x - p1.x + 1) * SNAKE_PX_STRIDE,
-			(p2.y - p1.y + 1) * SNAKE_PX_STRIDE
+			(p2.y - p1.y + 1) * SNAKE_PX_STRIDE,
+			SNAKE_COLOR
 		);
 	}
 }
 
 static void draw_food(struct Pos food)
 {
-	gfx_SetColor(FOOD_COLOR);
-	gfx_FillRectangle(
+	fill_rect(
 		food.x * SNAKE_PX_STRIDE, food.y * SNAKE_PX_STRIDE,
-		SNAKE_PX_STRIDE, SNAKE_PX_STRIDE
+		SNAKE_PX_STRIDE, SNAKE_PX_STRIDE, FOOD_COLOR
 	);
 }
 
+/* The snake is drawn in 4bpp while playing and with graphx on the screen
+ * shown when it dies.
+ */
+static void fill_rect(int x, int y, int width, int height, uint8_t color)
+{
+	if (lcd4_active()) {
+		lcd4_fill_rect(x, y, width, height, color);
+	} else {
+		gfx_SetColor(color);
+		gfx_FillRectangle(x, y, width, height);
+	}
+}
+
 /* Returns a random vertex in the snake grid. */
 static struct Pos random_vert(void)
 {
 	struct Pos vert = {
-		.x = randInt(0, SNAKE_GRID_WIDTH - 1),
-		.y = randInt(0, SNAKE_GRID_HEIGHT - 1),
+		.x = rng_below(&rng_streams[RNG_SNAKE], SNAKE_GRID_WIDTH),
+		.y = rng_below(&rng_streams[RNG_SNAKE], SNAKE_GRID_HEIGHT),
 	};
 	return vert;
 }
@@ -292,4 +357,73 @@ static bool iteredges(struct Snake snake, struct Pos *dp1, struct Pos *dp2)
 
 	node = next;
 	return true;
-}
\ No newline at end of file
+}
+
+static void save_snapshot(struct Snake snake, struct Pos food, uint24_t score,
+	uint24_t tail_growth, enum LookDir head_dir)
+{
+	arena_mark_t mark = arena_mark(&arena);
+	struct Snapshot *snap = arena_alloc(&arena, sizeof *snap);
+	if (!snap)
+		return;
+
+	snap->rng = rng_streams[RNG_SNAKE];
+	snap->food = food;
+	snap->score = score;
+	snap->tail_growth = tail_growth;
+	snap->head_dir = head_dir;
+	snap->n_verts = 0;
+	for (struct Pos *v = snake.tail; ; v = next_vertex(v)) {
+		snap->verts[snap->n_verts++] = *v;
+		if (v == snake.head)
+			break;
+	}
+
+	snapshot_save(SNAKE_SNAPSHOT, snap, offsetof(struct Snapshot, verts)
+		+ snap->n_verts * sizeof snap->verts[0]);
+	arena_release(&arena, mark);
+}
+
+static bool on_grid(struct Pos p)
+{
+	return p.x < SNAKE_GRID_WIDTH && p.y < SNAKE_GRID_HEIGHT;
+}
+
+/* Returns false if there is no game to resume, or if the saved one doesn't
+ * fit on the grid. The vertices are moved to the start of vertdata.
+ */
+static bool load_snapshot(struct Snake *snake, struct Pos *food,
+	uint24_t *score, uint24_t *tail_growth, enum LookDir *head_dir)
+{
+	arena_mark_t mark = arena_mark(&arena);
+	struct Snapshot *snap = arena_alloc(&arena, sizeof *snap);
+	if (!snap)
+		return false;
+
+	size_t size = snapshot_load(SNAKE_SNAPSHOT, snap, sizeof *snap);
+	bool ok = size >= offsetof(struct Snapshot, verts)
+		&& snap->n_verts >= 2
+		&& snap->n_verts <= SNAKE_VERTDATA_LEN
+		&& size == offsetof(struct Snapshot, verts)
+			+ snap->n_verts * sizeof snap->verts[0]
+		&& snap->head_dir <= D_DOWN
+		&& on_grid(snap->food);
+
+	for (uint24_t i = 0; ok && i < snap->n_verts; ++i)
+		ok = on_grid(snap->verts[i]);
+
+	if (ok) {
+		memcpy(vertdata, snap->verts,
+			snap->n_verts * sizeof snap->verts[0]);
+		snake->tail = &vertdata[0];
+		snake->head = &vertdata[snap->n_verts - 1];
+		if (snap->rng.state)
+			rng_streams[RNG_SNAKE] = snap->rng;
+		*food = snap->food;
+		*score = snap->score;
+		*tail_growth = snap->tail_growth;
+		*head_dir = snap->head_dir;
+	}
+	arena_release(&arena, mark);
+	return ok;
+}
@@ -0,0 +1,64 @@
+#include <fileioc.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "snapshot.h"
+
+/* Stored in front of every snapshot. Bump it when the format of any game's
+ * snapshot changes, so that old ones are thrown away instead of misread.
+ */
+#define SNAPSHOT_VERSION 2
+
+/* Copies the snapshot into data and returns its size, or 0 if there is no
+ * usable snapshot.
+ */
+size_t snapshot_load(const char *name, void *data, size_t max_size)
+{
+	uint8_t handle = ti_Open(name, "r");
+	if (!handle)
+		return 0;
+
+	const uint8_t *stored = ti_GetDataPtr(handle);
+	size_t size = ti_GetSize(handle);
+	ti_Close(handle);
+
+	if (size < 1 || size - 1 > max_size || stored[0] != SNAPSHOT_VERSION)
+		return 0;
+	memcpy(data, stored + 1, size - 1);
+	return size - 1;
+}
+
+void snapshot_save(const char *name, const void *data, size_t size)
+{
+	uint8_t handle = ti_Open(name, "r");
+	if (handle) {
+		const uint8_t *stored = ti_GetDataPtr(handle);
+		bool same = ti_GetSize(handle) == size + 1
+			&& stored[0] == SNAPSHOT_VERSION
+			&& !memcmp(stored + 1, data, size);
+		ti_Close(handle);
+		// Spares the flash a write if nothing happened since the load.
+		if (same)
+			return;
+		ti_Delete(name);
+	}
+
+	if (!(handle = ti_Open(name, "w")))
+		return;
+	uint8_t version = SNAPSHOT_VERSION;
+	if (ti_Write(&version, 1, 1, handle) == 1
+		&& ti_Write(data, size, 1, handle) == 1) {
+		ti_SetArchiveStatus(true, handle);
+		ti_Close(handle);
+	} else {
+		// Out of RAM, a partial snapshot would be misread later.
+		ti_Close(handle);
+		ti_Delete(name);
+	}
+}
+
+void snapshot_discard(const char *name)
+{
+	ti_Delete(name);
+}
@@ -0,0 +1,22 @@
+/* Games keep their state across visits to the menu by saving a snapshot of
+ * it when the player leaves with Clear. A snapshot is a game's own compact
+ * encoding of its state, stored in an archived AppVar of its own. It is
+ * only written to flash if it differs from the one already stored, and it
+ * is deleted when the game ends.
+ */
+
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include <stddef.h>
+
+#define SUDOKU_SNAPSHOT "MASUDOKU"
+#define SOKOBAN_SNAPSHOT "MASOKOBN"
+#define G2048_SNAPSHOT "MA2048"
+#define SNAKE_SNAPSHOT "MASNAKE"
+
+size_t snapshot_load(const char *name, void *data, size_t max_size);
+void snapshot_save(const char *name, const void *data, size_t size);
+void snapshot_discard(const char *name);
+
+#endif // SNAPSHOT_H
@@ -3,155 +3,646 @@
 #include <tice.h>
 #include <stdio.h>
 #include <stdbool.h>
+#include <stdlib.h>
 #include <string.h>
-#include <compression.h>
+#include <time.h>
 #include <debug.h>
 
 #include "common.h"
 
-#define levels        share.sokoban_bss.levels
-#define level         share.sokoban_bss.level
-#define playerx       share.sokoban_bss.playerx
-#define playery       share.sokoban_bss.playery
-#define width         share.sokoban_bss.width
-#define height        share.sokoban_bss.height
-#define player_sprite share.sokoban_bss.player_sprite
+/* Cells are 16 pixels wide, or 8 in the overview, which fits the largest
+ * levels on the screen.
+ */
+#define CELL_LOG2_PX 4
+#define OVERVIEW_LOG2_PX 3
+
+/* How close the player gets to the edge of the screen before a level larger
+ * than the screen scrolls, in cells.
+ */
+#define SCROLL_MARGIN 3
+
+// The least time the number of a level is shown before it, in ms.
+#define BANNER_MIN_MS 500
+
+// How long the player takes over a cell when walking to one, in ms.
+#define WALK_STEP_MS 50
+
+/* The level is kept in a grid as wide as 32 cells, which is more than the
+ * widest level, so that a row is a shift away rather than a multiply by the
+ * width.
+ *
+ * The grid is three bit planes, for the walls, the goals and the boxes. A
+ * plane has a uint32_t per row with bit x for column x, which, as both the
+ * calculator and the host are little-endian, is bit LEVELIDX(x, y) of the
+ * plane read as bytes. A cell is looked up with BITS_GET() on PLANE(), and
+ * a question about the whole level takes an operation per row instead of
+ * one per cell.
+ */
+#define LEVEL_LOG2_STRIDE 5
+#define LEVEL_X_MASK ((1 << LEVEL_LOG2_STRIDE) - 1)
+#define LEVEL_ROWS LEVEL_MAX_H
+#define PLANE(rows) ((uint8_t *) (rows))
+#define LEVEL_GRID_SIZE (LEVEL_ROWS << LEVEL_LOG2_STRIDE)
+
+#define LEVEL_MAX_CELLS (LEVEL_MAX_W * LEVEL_MAX_H)
+
+// The most cells a move changes, times the two frames a buffer misses.
+#define VIEW_MAX_DIRTY 8
+
+// The ways to move, as arrow() numbers them, and where the player faces.
+static const int8_t steps[4][2] = { { -1, 0 }, { 1, 0 }, { 0, -1 }, { 0, 1 } };
+static const uint8_t facing[4] = {
+	ASSET_SOKOBAN_LEFT,
+	ASSET_SOKOBAN_RIGHT,
+	ASSET_SOKOBAN_UP,
+	ASSET_SOKOBAN_DOWN,
+};
+
+// The packs to play from, which the level select switches between.
+enum Pack {
+	PACK_BUILTIN = 0,
+	PACK_IMPORTED,
+	N_PACKS,
+};
+
+static const char *const pack_names[N_PACKS] = {
+	LEVELPACK_BUILTIN,
+	LEVELPACK_IMPORTED,
+};
+
+/* What one of the two buffers shows: which cell is at its top left, and the
+ * cells that changed since it was drawn. n_dirty > VIEW_MAX_DIRTY means that
+ * it has to be drawn from scratch.
+ */
+struct View {
+	bool drawn;
+	uint8_t x, y;
+	uint8_t n_dirty;
+	struct Pos dirty[VIEW_MAX_DIRTY];
+};
+
+static struct {
+	uint8_t width, height;
+	uint8_t playerx, playery;
+	uint16_t level_id;
+	uint8_t pack_id;
+
+	// The asset of the player sprite at full size.
+	uint8_t player_asset;
+
+	// The cell at the top left of the screen, and where the level starts.
+	uint8_t camx, camy;
+	int offx, offy;
+	uint8_t cell_log2_px;
+	struct View views[2];
+
+	uint32_t walls[LEVEL_ROWS];
+	uint32_t goals[LEVEL_ROWS];
+	uint32_t boxes[LEVEL_ROWS];
+	// The cells a box can still be pushed to a goal from, see find_live().
+	uint32_t live[LEVEL_ROWS];
+	// A box that the player wasn't let push, shown until their next move.
+	bool warning;
+	struct Pos warned;
+	// The level pack, which stays in the archive.
+	const struct LevelPack *pack;
+	// Where the pack is in the arena, so that another can replace it.
+	arena_mark_t pack_mark;
+	/* The cells of the level being loaded, in scratch RAM. While it is
+	 * played, the steps of the walk find_path() found instead.
+	 */
+	uint8_t *cells;
+	// The cells still to visit of a search of the level, in scratch RAM.
+	uint16_t *queue;
+} *bss;
+
+#define pack            bss->pack
+#define pack_id         bss->pack_id
+#define pack_mark       bss->pack_mark
+#define cells           bss->cells
+#define walls           bss->walls
+#define goals           bss->goals
+#define boxes           bss->boxes
+#define live            bss->live
+#define warning         bss->warning
+#define warned          bss->warned
+#define queue           bss->queue
+#define playerx         bss->playerx
+#define playery         bss->playery
+#define width           bss->width
+#define height          bss->height
+#define player_asset    bss->player_asset
+#define camx            bss->camx
+#define camy            bss->camy
+#define offx            bss->offx
+#define offy            bss->offy
+#define cell_log2_px    bss->cell_log2_px
+#define views           bss->views
+#define level_id        bss->level_id
 
 /* Sokoban levels taken from
  * http://www.sneezingtiger.com/sokoban/levels/microbanText.html
  *
- * The level format is as follows:
- * width (1B)
- * height (1B)
- * player x (1B)
- * player y (1B)
- * level data (size B)...
- *
- * Each token has the bitpattern:
- *  BOX_TILE, GOAL_TILE, WALL/FLOOR TILE, IS_RLE
+ * How the levels are stored is in levelpack.h.
  */
-#define BOX_BIT  0b1000
-#define GOAL_BIT 0b0100
-#define WALL_BIT 0b0010
-#define RLE_BIT  0b0001
-
-#define HEADER_SIZE 4
-#define CELL_PX_WIDTH 16
 
-#define LEVELIDX(x, y) ((x) + (y) * width)
+#define LEVELIDX(x, y) GRID_INDEX(x, y, LEVEL_LOG2_STRIDE)
 
-static void load_level(int levelid);
+static bool load_level(uint16_t id);
 static void draw_level(void);
+static bool start_level(void);
+static void show_first_frame(void);
 static bool play(void);
 static bool check_level_complete(void);
+static bool point_and_walk(void);
+static bool find_path(uint8_t x, uint8_t y);
+static void player_reach(uint32_t *reach, uint8_t x, uint8_t y);
+static void find_live(void);
+static bool deadlocked(uint8_t x, uint8_t y);
+static bool open_pack(uint8_t id);
+static void import_levels(void);
+static bool select_level(void);
+static void save_snapshot(void);
+static bool load_snapshot(void);
 
-static void draw_level(void)
+/* The tiles of the level being played are saved rather than just its boxes,
+ * so that resuming doesn't need the level pack to be decoded.
+ */
+struct Snapshot {
+	uint8_t pack_no;
+	uint16_t id;
+	uint8_t w, h;
+	uint8_t player_x, player_y;
+	// The asset of the player sprite.
+	uint8_t facing;
+	// Two tiles per byte.
+	uint8_t tiles[(LEVEL_MAX_CELLS + 1) / 2];
+};
+
+static void print_centered(const char *s, int y)
 {
-	int offx = (LCD_WIDTH / CELL_PX_WIDTH - width)
-		* CELL_PX_WIDTH / 2;
-	int offy = (LCD_HEIGHT / CELL_PX_WIDTH - height)
-		* CELL_PX_WIDTH / 2;
+	gfx_PrintStringXY(s, (GFX_LCD_WIDTH - gfx_GetStringWidth(s)) / 2, y);
+}
 
-	gfx_FillScreen(WHITE);
-	for (int y = 0; y < height; ++y) {
-		for (int x = 0; x < width; ++x) {
-			int px = offx + x * CELL_PX_WIDTH;
-			int py = offy + y * CELL_PX_WIDTH;
-			uint8_t tile = level[LEVELIDX(x, y)];
-
-			gfx_sprite_t *sprite;
-
-			if (tile & WALL_BIT) {
-				sprite = sprite_sokoban_wall;
-			} else {
-				switch (tile & (GOAL_BIT | BOX_BIT)) {
-				case GOAL_BIT:
-					sprite = sprite_sokoban_goal;
-					break;
-				case BOX_BIT:
-					sprite = sprite_sokoban_box;
-					break;
-				case BOX_BIT | GOAL_BIT:
-					sprite = sprite_sokoban_gold_box;
-					break;
-				default:
-					continue;
-				}
-			}
+static void clear_planes(void)
+{
+	memset(walls, 0, sizeof walls);
+	memset(goals, 0, sizeof goals);
+	memset(boxes, 0, sizeof boxes);
+}
+
+// Sets cell i, which is empty, to the flags of tile.
+static void set_tile(uint16_t i, uint8_t tile)
+{
+	if (tile & WALL_BIT)
+		BITS_SET(PLANE(walls), i);
+	if (tile & GOAL_BIT)
+		BITS_SET(PLANE(goals), i);
+	if (tile & BOX_BIT)
+		BITS_SET(PLANE(boxes), i);
+}
 
-			gfx_Sprite(sprite, px, py);
+// The flags of cell i, as levels are stored.
+static uint8_t tile_at(uint16_t i)
+{
+	return BITS_GET(PLANE(walls), i) * WALL_BIT
+		| BITS_GET(PLANE(goals), i) * GOAL_BIT
+		| BITS_GET(PLANE(boxes), i) * BOX_BIT;
+}
+
+// A tile or player asset at the size cells are drawn at.
+static gfx_sprite_t *sprite_at_size(uint8_t asset)
+{
+	if (cell_log2_px == OVERVIEW_LOG2_PX)
+		asset += ASSET_SOKOBAN_WALL_HALF - ASSET_SOKOBAN_WALL;
+	return asset_get(asset);
+}
+
+/* The first cell to show of a level size cells across on a screen that fits
+ * view cells, for the player at p to be at least SCROLL_MARGIN cells from
+ * its edges when the camera was at cam.
+ */
+static uint8_t follow(uint8_t cam, uint8_t p, uint8_t size, uint8_t view)
+{
+	if (size <= view)
+		return 0;
+	if (p < cam + SCROLL_MARGIN)
+		cam = (p > SCROLL_MARGIN) ? p - SCROLL_MARGIN : 0;
+	else if (p + SCROLL_MARGIN >= cam + view)
+		cam = p + SCROLL_MARGIN + 1 - view;
+	return (cam > size - view) ? size - view : cam;
+}
+
+static void follow_player(void)
+{
+	camx = follow(camx, playerx, width, LCD_WIDTH >> cell_log2_px);
+	camy = follow(camy, playery, height, LCD_HEIGHT >> cell_log2_px);
+}
+
+/* Centers the level, or the player if the level doesn't fit, at the current
+ * cell size. Both buffers are drawn from scratch next.
+ */
+static void reset_view(void)
+{
+	uint8_t view_w = LCD_WIDTH >> cell_log2_px;
+	uint8_t view_h = LCD_HEIGHT >> cell_log2_px;
+
+	offx = (width < view_w) ? (view_w - width) << cell_log2_px >> 1 : 0;
+	offy = (height < view_h) ? (view_h - height) << cell_log2_px >> 1 : 0;
+	camx = (playerx > view_w / 2) ? playerx - view_w / 2 : 0;
+	camy = (playery > view_h / 2) ? playery - view_h / 2 : 0;
+	follow_player();
+	views[0].drawn = views[1].drawn = false;
+}
+
+// Cell x, y needs drawing again in both buffers.
+static void mark_dirty(uint8_t x, uint8_t y)
+{
+	for (int i = 0; i < 2; ++i) {
+		struct View *v = &views[i];
+		if (v->n_dirty < VIEW_MAX_DIRTY)
+			v->dirty[v->n_dirty] = (struct Pos) { x, y };
+		if (v->n_dirty <= VIEW_MAX_DIRTY)
+			++v->n_dirty;
+	}
+}
+
+/* Draws a cell that is on the screen. Floor is only drawn if clear is set,
+ * as it is the background.
+ */
+static void draw_cell(uint8_t x, uint8_t y, bool clear)
+{
+	int px = offx + ((x - camx) << cell_log2_px);
+	int py = offy + ((y - camy) << cell_log2_px);
+	uint8_t tile = tile_at(LEVELIDX(x, y));
+	uint8_t asset;
+
+	if (tile & WALL_BIT) {
+		asset = ASSET_SOKOBAN_WALL;
+	} else {
+		switch (tile & (GOAL_BIT | BOX_BIT)) {
+		case GOAL_BIT:
+			asset = ASSET_SOKOBAN_GOAL;
+			break;
+		case BOX_BIT:
+			asset = ASSET_SOKOBAN_BOX;
+			break;
+		case BOX_BIT | GOAL_BIT:
+			asset = ASSET_SOKOBAN_GOLD_BOX;
+			break;
+		default:
+			if (clear) {
+				gfx_SetColor(WHITE);
+				gfx_FillRectangle(px, py, 1 << cell_log2_px,
+					1 << cell_log2_px);
+			}
+			return;
 		}
 	}
-	gfx_TransparentSprite(player_sprite,
-		playerx * CELL_PX_WIDTH + offx,
-		playery * CELL_PX_WIDTH + offy);
+	gfx_Sprite(sprite_at_size(asset), px, py);
+	if (warning && x == warned.x && y == warned.y) {
+		gfx_SetColor(RED);
+		gfx_Rectangle(px, py, 1 << cell_log2_px, 1 << cell_log2_px);
+	}
 }
 
-void sokoban_mainloop(void)
+/* Draws the cells from x0, y0 up to x1, y1 that are part of the level and
+ * on the screen.
+ */
+static void draw_cells(int x0, int y0, int x1, int y1, bool clear)
 {
-	zx7_Decompress(levels, sokoban_levels);
-#ifdef DEBUG
-	for (int i = 0; i < SOKOBAN_LEVELS_SIZE; i++) {
-		dbg_printf("%02x ", levels[i]);
-		if ((i + 1) % 16 == 0) dbg_printf("\n");
+	int view_x1 = camx + (LCD_WIDTH >> cell_log2_px);
+	int view_y1 = camy + (LCD_HEIGHT >> cell_log2_px);
+
+	if (x0 < camx)
+		x0 = camx;
+	if (y0 < camy)
+		y0 = camy;
+	if (x1 > width)
+		x1 = width;
+	if (x1 > view_x1)
+		x1 = view_x1;
+	if (y1 > height)
+		y1 = height;
+	if (y1 > view_y1)
+		y1 = view_y1;
+	for (int y = y0; y < y1; ++y) {
+		for (int x = x0; x < x1; ++x)
+			draw_cell(x, y, clear);
 	}
-#endif
+}
+
+/* Moves what the buffer shows by the cells the camera moved since, and draws
+ * the rows and columns that came into view.
+ */
+static void scroll(int dx, int dy)
+{
+	int view_w = LCD_WIDTH >> cell_log2_px;
+	int view_h = LCD_HEIGHT >> cell_log2_px;
+
+	if (dx > 0) {
+		gfx_ShiftLeft(dx << cell_log2_px);
+		draw_cells(camx + view_w - dx, camy, camx + view_w,
+			camy + view_h, true);
+	} else if (dx < 0) {
+		gfx_ShiftRight(-dx << cell_log2_px);
+		draw_cells(camx, camy, camx - dx, camy + view_h, true);
+	}
+	if (dy > 0) {
+		gfx_ShiftUp(dy << cell_log2_px);
+		draw_cells(camx, camy + view_h - dy, camx + view_w,
+			camy + view_h, true);
+	} else if (dy < 0) {
+		gfx_ShiftDown(-dy << cell_log2_px);
+		draw_cells(camx, camy, camx + view_w, camy - dy, true);
+	}
+}
+
+/* Brings the buffer being drawn up to date. Only the cells that changed since
+ * it was last drawn are drawn again, and when the camera moved, what it shows
+ * is shifted and only the cells that came into view are drawn, so a frame
+ * costs about the same whatever the size of the level.
+ */
+static void draw_level(void)
+{
+	struct View *v = &views[g_buffer()];
+	int dx = camx - v->x, dy = camy - v->y;
 
-	for (int i = 0; i < SOKOBAN_NUM_LEVELS; ++i) {
+	if (!v->drawn || v->n_dirty > VIEW_MAX_DIRTY
+		|| abs(dx) >= LCD_WIDTH >> cell_log2_px >> 1
+		|| abs(dy) >= LCD_HEIGHT >> cell_log2_px >> 1) {
 		gfx_FillScreen(WHITE);
+		draw_cells(0, 0, width, height, false);
+	} else {
+		scroll(dx, dy);
+		for (uint8_t i = 0; i < v->n_dirty; ++i)
+			draw_cells(v->dirty[i].x, v->dirty[i].y,
+				v->dirty[i].x + 1, v->dirty[i].y + 1, true);
+		// The player may only have turned.
+		draw_cell(playerx, playery, true);
+	}
+	gfx_TransparentSprite(sprite_at_size(player_asset),
+		offx + ((playerx - camx) << cell_log2_px),
+		offy + ((playery - camy) << cell_log2_px));
+
+	v->drawn = true;
+	v->x = camx;
+	v->y = camy;
+	v->n_dirty = 0;
+}
 
-		char s[16];
-		sprintf(s, "LEVEL %d", i);
-		gfx_PrintStringXY(s,
-			(GFX_LCD_WIDTH - gfx_GetStringWidth(s)) / 2,
-			GFX_LCD_HEIGHT / 2);
+void sokoban_mainloop(void)
+{
+	if (!(bss = arena_alloc(&arena, sizeof *bss)))
+		return;
+	pack_mark = arena_mark(&arena);
+	if (!(cells = arena_alloc(&scratch, LEVEL_GRID_SIZE)))
+		return;
+	cell_log2_px = CELL_LOG2_PX;
+	if (levelimport_pending())
+		import_levels();
+	// Only now, as importing needs the room.
+	if (!(queue = arena_alloc(&scratch, LEVEL_MAX_CELLS * sizeof *queue)))
+		return;
+
+	bool resumed = load_snapshot();
+	if (!resumed) {
+		if (!open_pack(pack_id) && !open_pack(PACK_BUILTIN))
+			return;
+		if (!select_level())
+			return;
+	}
+	for (; level_id < pack->index->n_levels; ++level_id) {
+		if (resumed) {
+			reset_view();
+			draw_level();
+		} else if (!start_level()) {
+			continue;
+		}
+		resumed = false;
+		show_first_frame();
 
-		gfx_SwapDraw();
-		usleep(1000000);
-		load_level(i);
-		if (!play())
+		if (!play()) {
+			save_snapshot();
 			return;
+		}
 	}
+	snapshot_discard(SOKOBAN_SNAPSHOT);
 }
 
-static bool play(void)
+/* Shows the number of the level while it is loaded and its first frame is
+ * drawn behind it, so that the banner lasts as long as that work, but at
+ * least BANNER_MIN_MS. Returns false if the level can't be loaded.
+ */
+static bool start_level(void)
+{
+	char s[16];
+
+	gfx_FillScreen(WHITE);
+	sprintf(s, "LEVEL %u", level_id);
+	print_centered(s, GFX_LCD_HEIGHT / 2);
+	g_swap();
+	clock_t start = clock();
+
+	if (!load_level(level_id))
+		return false;
+	player_asset = ASSET_SOKOBAN_LEFT;
+	reset_view();
+	draw_level();
+
+	unsigned long ms = (clock() - start) * 1000 / CLOCKS_PER_SEC;
+	if (ms < BANNER_MIN_MS)
+		usleep((BANNER_MIN_MS - ms) * 1000);
+	return true;
+}
+
+/* Shows the level drawn in the buffer and copies it to the other one, while
+ * the player is yet to press a key, so that the first move only draws what
+ * it changes.
+ */
+static void show_first_frame(void)
+{
+	struct View drawn = views[g_buffer()];
+
+	g_swap();
+	gfx_BlitScreen();
+	views[g_buffer()] = drawn;
+}
+
+/* Moves the player by dx, dy, pushing the box in the way if nothing is behind
+ * it. Returns false if they can't move there, which includes pushes that
+ * leave the level unsolvable: the box is then marked instead.
+ */
+static bool move(int dx, int dy)
 {
-	player_sprite = sprite_sokoban_left;
+	uint16_t next1 = LEVELIDX(playerx + dx, playery + dy);
+	uint16_t next2 = LEVELIDX(playerx + dx * 2, playery + dy * 2);
+
+	if (warning) {
+		warning = false;
+		mark_dirty(warned.x, warned.y);
+	}
+	if (BITS_GET(PLANE(walls), next1))
+		return false;
+	if (BITS_GET(PLANE(boxes), next1)) {
+		if (BITS_GET(PLANE(walls), next2)
+			|| BITS_GET(PLANE(boxes), next2))
+			return false;
+		BITS_SET(PLANE(boxes), next2);
+		BITS_CLEAR(PLANE(boxes), next1);
+		if (deadlocked(playerx + dx * 2, playery + dy * 2)) {
+			BITS_SET(PLANE(boxes), next1);
+			BITS_CLEAR(PLANE(boxes), next2);
+			warning = true;
+			warned = (struct Pos) { playerx + dx, playery + dy };
+			mark_dirty(warned.x, warned.y);
+			return false;
+		}
+		mark_dirty(playerx + dx * 2, playery + dy * 2);
+	}
+
+	mark_dirty(playerx, playery);
+	playerx += dx;
+	playery += dy;
+	follow_player();
+	return true;
+}
+
+// Which of steps an arrow key is, or -1 for other keys.
+static int8_t arrow(uint8_t key)
+{
+	switch (key) {
+	case sk_Left:
+		return 0;
+	case sk_Right:
+		return 1;
+	case sk_Up:
+		return 2;
+	case sk_Down:
+		return 3;
+	default:
+		return -1;
+	}
+}
+
+/* Walks the player to x, y along the path find_path() left, a frame per
+ * step. A step only draws the cells the player leaves and enters.
+ */
+static void walk(uint8_t x, uint8_t y)
+{
+	while (playerx != x || playery != y) {
+		uint8_t d = cells[LEVELIDX(playerx, playery)];
+
+		BENCH_MARK();
+		player_asset = facing[d];
+		move(steps[d][0], steps[d][1]);
+		draw_level();
+		g_swap();
+		BENCH_FRAME(BENCH_SOKOBAN);
+		usleep(WALK_STEP_MS * 1000);
+	}
+}
+
+/* Whether x, y, which may be off the level, is in reach (see
+ * player_reach()). The search for a path is only made if it is, which saves
+ * it going through every cell the player can get to for nothing.
+ */
+static bool in_reach(const uint32_t *reach, uint8_t x, uint8_t y)
+{
+	return x < width && y < height && BITS_GET(PLANE(reach), LEVELIDX(x, y));
+}
+
+/* Lets the player point at a cell with the arrows and 2nd to walk there, or
+ * at a box and then an arrow to walk up to it and push it that way. clear
+ * goes back to moving a step at a time. The screen follows the cursor.
+ * Returns true if the push solves the level.
+ */
+static bool point_and_walk(void)
+{
+	struct Pos at = { playerx, playery };
+	bool pushing = false;
+	uint32_t reach[LEVEL_ROWS];
+
+	// Nothing moves until the walk, so where the player can go is known.
+	player_reach(reach, playerx, playery);
+
 	for (;;) {
-		int key;
+		int key, d;
 
 		draw_level();
-		gfx_SwapDraw();
+		gfx_SetColor(pushing ? BLUE : BLACK);
+		gfx_Rectangle(offx + ((at.x - camx) << cell_log2_px),
+			offy + ((at.y - camy) << cell_log2_px),
+			1 << cell_log2_px, 1 << cell_log2_px);
+		g_swap();
+		BENCH_FRAME(BENCH_SOKOBAN);
 
 		while (!(key = os_GetCSC()))
 			;
-		/* Validate if the player can move there.
-		 * a player can move somewhere if:
-		 * there is at least 1 floor/dest in the direction they are
-		 * going before a ray hits a wall
-		 */
-		int dx, dy;
+		BENCH_MARK();
+		mark_dirty(at.x, at.y);
+		d = arrow(key);
+
+		if (pushing && d >= 0) {
+			uint8_t x = at.x - steps[d][0], y = at.y - steps[d][1];
+			if (!in_reach(reach, x, y) || !find_path(x, y))
+				return false;
+			walk(x, y);
+			player_asset = facing[d];
+			return move(steps[d][0], steps[d][1])
+				&& check_level_complete();
+		} else if (d >= 0) {
+			// The cursor stays on the level.
+			if ((uint8_t) (at.x + steps[d][0]) < width)
+				at.x += steps[d][0];
+			if ((uint8_t) (at.y + steps[d][1]) < height)
+				at.y += steps[d][1];
+			camx = follow(camx, at.x, width,
+				LCD_WIDTH >> cell_log2_px);
+			camy = follow(camy, at.y, height,
+				LCD_HEIGHT >> cell_log2_px);
+		} else if (key == sk_2nd) {
+			if (BITS_GET(PLANE(boxes), LEVELIDX(at.x, at.y))) {
+				pushing = true;
+				continue;
+			}
+			if (in_reach(reach, at.x, at.y) && find_path(at.x, at.y))
+				walk(at.x, at.y);
+			return false;
+		} else if (key == sk_Clear) {
+			return false;
+		}
+		pushing = false;
+	}
+}
+
+/* Plays the level on the screen. Returns false if the player left it. */
+static bool play(void)
+{
+	for (;;) {
+		int key, dx = 0, dy = 0;
+
+		while (!(key = os_GetCSC()))
+			;
+		BENCH_MARK();
 
 		switch (key) {
 		case sk_Left:
-			player_sprite = sprite_sokoban_left;
-			dx = -1;
-			dy = 0;
-			break;
 		case sk_Right:
-			player_sprite = sprite_sokoban_right;
-			dx = 1;
-			dy = 0;
-			break;
 		case sk_Up:
-			player_sprite = sprite_sokoban_up;
-			dx = 0;
-			dy = -1;
-			break;
 		case sk_Down:
-			player_sprite = sprite_sokoban_down;
-			dx = 0;
-			dy = 1;
+			player_asset = facing[arrow(key)];
+			dx = steps[arrow(key)][0];
+			dy = steps[arrow(key)][1];
+			break;
+		case sk_2nd:
+			if (point_and_walk())
+				return true;
+			follow_player();
+			break;
+		case sk_Zoom:
+			cell_log2_px ^= CELL_LOG2_PX ^ OVERVIEW_LOG2_PX;
+			reset_view();
 			break;
 		case sk_Clear:
 			return false;
@@ -160,47 +651,561 @@ static bool play(void)
 			continue;
 		}
 
-		uint8_t *next1_tile, *next2_tile;
+		// The player turns even if they can't move.
+		if ((dx || dy) && move(dx, dy) && check_level_complete())
+			return true;
 
-		next1_tile = &level[LEVELIDX(playerx + dx, playery + dy)];
-		next2_tile = &level[
-			LEVELIDX(playerx + dx * 2, playery + dy * 2)
-		];
+		draw_level();
+		g_swap();
+		BENCH_FRAME(BENCH_SOKOBAN);
+	}
+}
 
-		if (*next1_tile & WALL_BIT)
-			continue;
-		if (*next1_tile & BOX_BIT) {
-			if (*next2_tile & (WALL_BIT | BOX_BIT))
+/* Ensure that every box tile is on a goal tile. There are as many boxes as
+ * goals, so then every goal has a box.
+ */
+static bool check_level_complete(void)
+{
+	for (uint8_t y = 0; y < height; ++y) {
+		if (boxes[y] & ~goals[y])
+			return false;
+	}
+	return true;
+}
+
+/* Whether x, y is a wall or off the level, which comes to the same thing as
+ * levels are enclosed. x and y may have wrapped around below 0.
+ */
+static bool is_wall(uint8_t x, uint8_t y)
+{
+	return x >= width || y >= height
+		|| BITS_GET(PLANE(walls), LEVELIDX(x, y));
+}
+
+/* Finds the cells from which a box can be pushed to a goal, on an empty
+ * level, by pulling boxes back from the goals: a box can get to a cell from
+ * the one next to it if the player has room behind it. A box pushed
+ * anywhere else is stuck for good. Each cell is queued at most once, so this
+ * takes time linear in the size of the level.
+ */
+static void find_live(void)
+{
+	uint16_t head = 0, tail = 0;
+
+	memcpy(live, goals, sizeof live);
+	for (uint8_t y = 0; y < height; ++y) {
+		for (uint8_t x = 0; x < width; ++x) {
+			if (BITS_GET(PLANE(goals), LEVELIDX(x, y)))
+				queue[tail++] = LEVELIDX(x, y);
+		}
+	}
+	while (head < tail) {
+		uint16_t i = queue[head++];
+		uint8_t x = i & LEVEL_X_MASK;
+		uint8_t y = i >> LEVEL_LOG2_STRIDE;
+
+		for (uint8_t d = 0; d < 4; ++d) {
+			uint8_t bx = x + steps[d][0], by = y + steps[d][1];
+			uint16_t j = LEVELIDX(bx, by);
+			if (is_wall(bx, by) || BITS_GET(PLANE(live), j)
+				|| is_wall(bx + steps[d][0], by + steps[d][1]))
 				continue;
-			*next2_tile |= BOX_BIT;
-			*next1_tile &= ~BOX_BIT;
+			BITS_SET(PLANE(live), j);
+			queue[tail++] = j;
 		}
+	}
+}
+
+static bool frozen(uint8_t x, uint8_t y, bool *off_goal);
+
+/* Whether the box at x, y can't be pushed along the axis of dx, dy: a wall
+ * is on either side, a box that is frozen is, or either way would push it
+ * onto a cell it can't get to a goal from.
+ */
+static bool axis_blocked(uint8_t x, uint8_t y, int8_t dx, int8_t dy,
+	bool *off_goal)
+{
+	uint8_t ax = x - dx, ay = y - dy, bx = x + dx, by = y + dy;
+
+	if (is_wall(ax, ay) || is_wall(bx, by))
+		return true;
+	if (!BITS_GET(PLANE(live), LEVELIDX(ax, ay))
+		&& !BITS_GET(PLANE(live), LEVELIDX(bx, by)))
+		return true;
+	return (BITS_GET(PLANE(boxes), LEVELIDX(ax, ay))
+			&& frozen(ax, ay, off_goal))
+		|| (BITS_GET(PLANE(boxes), LEVELIDX(bx, by))
+			&& frozen(bx, by, off_goal));
+}
+
+/* Whether the box at x, y can never be pushed again. While its neighbours
+ * are looked at, the box is taken to be a wall, so that boxes holding each
+ * other in place are found without going round in circles. off_goal is set
+ * if one of the boxes that are stuck isn't on a goal.
+ */
+static bool frozen(uint8_t x, uint8_t y, bool *off_goal)
+{
+	uint16_t i = LEVELIDX(x, y);
+	bool was_off_goal = *off_goal;
+
+	BITS_SET(PLANE(walls), i);
+	bool stuck = axis_blocked(x, y, 1, 0, off_goal)
+		&& axis_blocked(x, y, 0, 1, off_goal);
+	BITS_CLEAR(PLANE(walls), i);
 
-		playerx += dx;
-		playery += dy;
+	// The boxes found stuck on the way only are if this one is.
+	if (!stuck)
+		*off_goal = was_off_goal;
+	else if (!BITS_GET(PLANE(goals), i))
+		*off_goal = true;
+	return stuck;
+}
 
-		if (check_level_complete())
+/* Whether the box just pushed to x, y leaves the level unsolvable, either
+ * on a cell it can't get to a goal from or stuck with a box off a goal.
+ */
+static bool deadlocked(uint8_t x, uint8_t y)
+{
+	bool off_goal = false;
+
+	if (!BITS_GET(PLANE(live), LEVELIDX(x, y)))
+		return true;
+	return frozen(x, y, &off_goal) && off_goal;
+}
+
+/* Finds a shortest walk of the player to x, y that pushes no box, searching
+ * from there back to the player so that the walk can be followed forwards.
+ * The step to take from each cell the search gets to is left in cells, which
+ * the level no longer needs. The queue is as long as the level has cells, as
+ * a cell is queued at most once. Returns false if the player can't get
+ * there.
+ *
+ * The cells the player can't walk on are marked seen to begin with, along
+ * with those right of the level, which keeps the search from wrapping
+ * around to the next row, so that a cell is looked at with a single bit.
+ */
+static bool find_path(uint8_t x, uint8_t y)
+{
+	uint32_t seen[LEVEL_ROWS];
+	uint32_t outside = ~(((uint32_t) 1 << width) - 1);
+	uint16_t end = LEVELIDX(0, height), to = LEVELIDX(x, y);
+	uint16_t head = 0, tail = 0;
+
+	for (uint8_t i = 0; i < height; ++i)
+		seen[i] = walls[i] | boxes[i] | outside;
+	if (x >= width || y >= height || BITS_GET(PLANE(seen), to))
+		return false;
+	BITS_SET(PLANE(seen), to);
+	queue[tail++] = to;
+	while (head < tail) {
+		uint16_t i = queue[head++];
+
+		if (i == LEVELIDX(playerx, playery))
 			return true;
+		for (uint8_t d = 0; d < 4; ++d) {
+			// Going up from the top row wraps around past the end.
+			uint16_t j = i + LEVELIDX(steps[d][0], steps[d][1]);
+			if (j >= end || BITS_GET(PLANE(seen), j))
+				continue;
+			BITS_SET(PLANE(seen), j);
+			// The way back from there, as d ^ 1 is the other way.
+			cells[j] = d ^ 1;
+			queue[tail++] = j;
+		}
 	}
+	return false;
 }
 
-/* Ensure that every box tile is on a goal tile */
-static bool check_level_complete(void)
+/* Spreads the bits of seed along the runs of free cells of a row they are
+ * in. The carry of an addition runs up through a run in one go, going down
+ * takes a shift per cell.
+ */
+static uint32_t spread_row(uint32_t seed, uint32_t free)
 {
-	for (int i = 0; i < width * height; ++i) {
-		uint8_t attr = level[i] & (GOAL_BIT | BOX_BIT);
-		if (attr == GOAL_BIT || attr == BOX_BIT)
-			return false;
+	uint32_t down, r;
+
+	// A seed on a blocked cell would carry past it.
+	seed &= free;
+	r = (((free + seed) ^ free) | seed) & free;
+
+	while ((down = r >> 1 & free & ~r))
+		r |= down;
+	return r;
+}
+
+/* Fills reach with the cells the player can walk to from x, y without
+ * pushing a box, a plane like the others. Rows are spread along and then
+ * into the rows next to them, going down the level and back up, until
+ * nothing changes.
+ */
+static void player_reach(uint32_t *reach, uint8_t x, uint8_t y)
+{
+	bool changed;
+
+	memset(reach, 0, LEVEL_ROWS * sizeof *reach);
+	reach[y] = spread_row((uint32_t) 1 << x, ~(walls[y] | boxes[y]));
+	do {
+		changed = false;
+		for (int8_t dir = 1; dir >= -1; dir -= 2) {
+			for (uint8_t i = 1; i < height; ++i) {
+				uint8_t y = (dir > 0) ? i : height - 1 - i;
+				uint32_t seed = reach[y - dir] & ~reach[y];
+				if (!seed)
+					continue;
+				uint32_t r = spread_row(seed | reach[y],
+					~(walls[y] | boxes[y]));
+				if (r != reach[y]) {
+					reach[y] = r;
+					changed = true;
+				}
+			}
+		}
+	} while (changed);
+}
+
+/* Returns false if the level doesn't fit on the screen or can't be read, in
+ * which case the level being played is left alone.
+ */
+/* Whether a level of the pack fits in the planes and has the player on it.
+ * Imported packs come from whatever text was on the calculator.
+ */
+static bool fits(const struct LevelBlock *b)
+{
+	return b && b->w <= LEVEL_MAX_W && b->h <= LEVEL_MAX_H
+		&& b->player_x < b->w && b->player_y < b->h;
+}
+
+static bool load_level(uint16_t id)
+{
+	const struct LevelBlock *b = levelpack_level(pack, id);
+	const uint8_t *p;
+	if (!fits(b) || !(p = levelpack_cells(b, cells))) {
+		dbg_printf("sokoban: can't load level %u\n", id);
+		return false;
+	}
+
+	width = b->w;
+	height = b->h;
+	playerx = b->player_x;
+	playery = b->player_y;
+
+	// The cells right of the level are floor.
+	clear_planes();
+	for (uint8_t y = 0; y < height; ++y) {
+		for (uint8_t x = 0; x < width; ++x)
+			set_tile(LEVELIDX(x, y), *p++);
 	}
+	find_live();
+	warning = false;
 	return true;
 }
 
-static void load_level(int levelid)
+/* Opens pack id in place of the one that is open. Returns false if an AppVar
+ * of the pack is missing or there isn't enough room, which leaves no pack
+ * open.
+ */
+static bool open_pack(uint8_t id)
 {
-	uint8_t *p = &levels[sokoban_level_table[levelid]];
-	width = p[0];
-	height = p[1];
-	playerx = p[2];
-	playery = p[3];
-	memcpy(level, &p[HEADER_SIZE], width * height);
+	arena_release(&arena, pack_mark);
+	if (!(pack = levelpack_open(&arena, pack_names[id])))
+		return false;
+	pack_id = id;
+	return true;
+}
+
+static void import_progress(const struct LevelImport *r)
+{
+	char s[32];
+
+	// Redrawing the screen takes longer than importing a level.
+	if ((r->n_levels + r->n_skipped) % 16)
+		return;
+	gfx_FillScreen(WHITE);
+	gfx_SetTextFGColor(BLACK);
+	print_centered("IMPORTING LEVELS", GFX_LCD_HEIGHT / 2 - CHAR_HEIGHT);
+	sprintf(s, "%u levels, %u skipped", r->n_levels, r->n_skipped);
+	print_centered(s, GFX_LCD_HEIGHT / 2 + CHAR_HEIGHT);
+	gfx_SwapDraw();
+}
+
+/* Turns levels sent as text into the imported pack, which is then played
+ * from. The outcome stays on the screen until a key is pressed.
+ */
+static void import_levels(void)
+{
+	struct LevelImport r;
+	char s[32];
+
+	bool ok = levelimport_run(&scratch, LEVELPACK_IMPORTED, &r,
+		import_progress);
+	if (ok)
+		pack_id = PACK_IMPORTED;
+
+	gfx_FillScreen(WHITE);
+	gfx_SetTextFGColor(BLACK);
+	print_centered(ok ? "LEVELS IMPORTED" : "IMPORT FAILED",
+		GFX_LCD_HEIGHT / 2 - CHAR_HEIGHT);
+	sprintf(s, "%u levels, %u skipped", r.n_levels, r.n_skipped);
+	print_centered(s, GFX_LCD_HEIGHT / 2 + CHAR_HEIGHT);
+	gfx_SwapDraw();
+	while (!os_GetCSC())
+		;
+}
+
+/* The level select shows a page of thumbnails, one pixel or two per cell.
+ * The slots are a bit larger than the thumbnails to leave room for the
+ * frame around the one picked.
+ */
+#define THUMB_COLS 6
+#define THUMB_ROWS 4
+#define THUMBS_PER_PAGE (THUMB_COLS * THUMB_ROWS)
+#define THUMB_SIZE 48
+#define SLOT_WIDTH 52
+#define SLOT_HEIGHT 50
+#define SLOTS_X ((GFX_LCD_WIDTH - THUMB_COLS * SLOT_WIDTH) / 2)
+#define SLOTS_Y (2 * CHAR_HEIGHT + 4)
+#define SELECT_FOOTER_Y (SLOTS_Y + THUMB_ROWS * SLOT_HEIGHT + 2)
+
+// By the flags of a cell. Floor is left as the background.
+static const uint8_t thumb_colors[16] = {
+	[WALL_BIT] = RED,
+	[GOAL_BIT] = GREEN,
+	[BOX_BIT] = GRAY2,
+	[BOX_BIT | GOAL_BIT] = BLUE,
+};
+
+static int slot_x(uint8_t slot)
+{
+	return SLOTS_X + slot % THUMB_COLS * SLOT_WIDTH;
+}
+
+static int slot_y(uint8_t slot)
+{
+	return SLOTS_Y + slot / THUMB_COLS * SLOT_HEIGHT;
+}
+
+static void draw_slot_frame(uint8_t slot, uint8_t color)
+{
+	int x = slot_x(slot), y = slot_y(slot);
+
+	gfx_SetColor(color);
+	gfx_HorizLine(x, y, SLOT_WIDTH);
+	gfx_HorizLine(x, y + SLOT_HEIGHT - 1, SLOT_WIDTH);
+	gfx_VertLine(x, y, SLOT_HEIGHT);
+	gfx_VertLine(x + SLOT_WIDTH - 1, y, SLOT_HEIGHT);
+}
+
+/* Draws level id in a slot straight from the pack, without loading it: its
+ * cells are only decoded into the scratch buffer if they are compressed,
+ * and a row is drawn a run of the same cells at a time.
+ */
+static void draw_thumbnail(uint16_t id, uint8_t slot)
+{
+	const struct LevelBlock *b = levelpack_level(pack, id);
+	const uint8_t *p;
+
+	if (!fits(b) || !(p = levelpack_cells(b, cells)))
+		return;
+
+	uint8_t w = b->w, h = b->h;
+	uint8_t px = (w <= THUMB_SIZE / 2 && h <= THUMB_SIZE / 2) ? 2 : 1;
+	int x0 = slot_x(slot) + (SLOT_WIDTH - w * px) / 2;
+	int y0 = slot_y(slot) + (SLOT_HEIGHT - h * px) / 2;
+
+	for (uint8_t y = 0; y < h; ++y) {
+		for (uint8_t x = 0; x < w;) {
+			uint8_t tile = *p, n = 1;
+			while (x + n < w && p[n] == tile)
+				++n;
+			if (thumb_colors[tile & 0xf]) {
+				gfx_SetColor(thumb_colors[tile & 0xf]);
+				gfx_FillRectangle(x0 + x * px, y0 + y * px,
+					n * px, px);
+			}
+			x += n;
+			p += n;
+		}
+	}
+	gfx_SetColor(BLACK);
+	gfx_FillRectangle(x0 + b->player_x * px, y0 + b->player_y * px,
+		px, px);
+}
+
+// What one of the two buffers shows of the level select.
+struct SelectView {
+	bool drawn;
+	// The first level of the page, and how many thumbnails are drawn.
+	uint16_t first;
+	uint8_t n_thumbs;
+	// The level with the frame around it.
+	uint16_t picked;
+};
+
+/* Lets the player pick the level to start from, the arrows moving across the
+ * page and on to the next or previous one and mode switching packs. Returns
+ * false if they left instead.
+ *
+ * The screen takes keys as soon as it is shown: the thumbnails are drawn one
+ * per frame while no key is pressed. As the two buffers alternate, each
+ * keeps track of which page, thumbnails and frame it has.
+ */
+static bool select_level(void)
+{
+	static const char *const titles[N_PACKS] = {
+		"BUILT-IN LEVELS",
+		"IMPORTED LEVELS",
+	};
+	struct SelectView shown[2] = { 0 };
+	// The page on the screen and how many of its thumbnails are due.
+	uint16_t page = 0;
+	uint8_t n_thumbs = 0;
+
+	for (;;) {
+		uint16_t n_levels = pack->index->n_levels;
+		uint16_t first = level_id - level_id % THUMBS_PER_PAGE;
+		uint8_t on_page = (n_levels - first < THUMBS_PER_PAGE) ?
+			n_levels - first : THUMBS_PER_PAGE;
+		const struct LevelBlock *b = levelpack_level(pack, level_id);
+		char s[32];
+
+		if (first != page) {
+			page = first;
+			n_thumbs = 0;
+		}
+
+		struct SelectView *v = &shown[g_buffer()];
+		if (!v->drawn || v->first != first) {
+			gfx_FillScreen(WHITE);
+			gfx_SetTextFGColor(BLACK);
+			sprintf(s, "%s (%u)", titles[pack_id], n_levels);
+			print_centered(s, CHAR_HEIGHT);
+			for (uint8_t i = 0; i < on_page; ++i)
+				draw_slot_frame(i, GRAY1);
+			v->drawn = true;
+			v->first = first;
+			v->n_thumbs = 0;
+			v->picked = level_id;
+		}
+		for (; v->n_thumbs < n_thumbs; ++v->n_thumbs)
+			draw_thumbnail(first + v->n_thumbs, v->n_thumbs);
+		draw_slot_frame(v->picked - first, GRAY1);
+		draw_slot_frame(level_id - first, BLACK);
+		v->picked = level_id;
+
+		gfx_SetColor(WHITE);
+		gfx_FillRectangle(0, SELECT_FOOTER_Y, GFX_LCD_WIDTH,
+			GFX_LCD_HEIGHT - SELECT_FOOTER_Y);
+		gfx_SetTextFGColor(BLACK);
+		if (b)
+			sprintf(s, "LEVEL %u, %u x %u", level_id, b->w, b->h);
+		else
+			sprintf(s, "LEVEL %u", level_id);
+		print_centered(s, SELECT_FOOTER_Y);
+		print_centered("2nd to play, mode for other levels",
+			SELECT_FOOTER_Y + CHAR_HEIGHT);
+		g_swap();
+
+		/* Waits for a key once both buffers have everything, and
+		 * otherwise draws another thumbnail if there is one.
+		 */
+		uint8_t key = os_GetCSC();
+		v = &shown[g_buffer()];
+		if (!key && n_thumbs == on_page && v->drawn && v->first == first
+			&& v->n_thumbs == n_thumbs && v->picked == level_id) {
+			while (!(key = os_GetCSC()))
+				;
+		}
+		if (!key && n_thumbs < on_page)
+			++n_thumbs;
+
+		switch (key) {
+		case sk_Left:
+			level_id = (level_id ? level_id : n_levels) - 1;
+			break;
+		case sk_Right:
+			if (++level_id == n_levels)
+				level_id = 0;
+			break;
+		case sk_Up:
+			if (level_id >= THUMB_COLS)
+				level_id -= THUMB_COLS;
+			break;
+		case sk_Down:
+			if (level_id + THUMB_COLS < n_levels)
+				level_id += THUMB_COLS;
+			break;
+		case sk_Mode:
+			// Stays on this pack if the other one isn't there.
+			if (open_pack(pack_id ^ 1))
+				level_id = 0;
+			else if (!open_pack(pack_id))
+				return false;
+			shown[0].drawn = shown[1].drawn = false;
+			n_thumbs = 0;
+			break;
+		case sk_2nd:
+		case sk_Enter:
+			return true;
+		case sk_Clear:
+			return false;
+		}
+	}
+}
+
+static void save_snapshot(void)
+{
+	struct Snapshot snap;
+
+	memset(&snap, 0, sizeof snap);
+	snap.pack_no = pack_id;
+	snap.id = level_id;
+	snap.w = width;
+	snap.h = height;
+	snap.player_x = playerx;
+	snap.player_y = playery;
+	snap.facing = player_asset;
+	for (int y = 0, i = 0; y < height; ++y) {
+		for (int x = 0; x < width; ++x, ++i)
+			snap.tiles[i / 2] |= tile_at(LEVELIDX(x, y)) << (i % 2 * 4);
+	}
+	snapshot_save(SOKOBAN_SNAPSHOT, &snap, sizeof snap);
+}
+
+/* Returns false if there is no game to resume. The pack it was from is
+ * opened if there is.
+ */
+static bool load_snapshot(void)
+{
+	struct Snapshot snap;
+
+	if (snapshot_load(SOKOBAN_SNAPSHOT, &snap, sizeof snap) != sizeof snap
+		|| snap.pack_no >= N_PACKS
+		|| !open_pack(snap.pack_no)
+		|| snap.id >= pack->index->n_levels
+		|| snap.w > LEVEL_MAX_W
+		|| snap.h > LEVEL_MAX_H
+		|| snap.player_x >= snap.w
+		|| snap.player_y >= snap.h
+		|| snap.facing < ASSET_SOKOBAN_UP
+		|| snap.facing > ASSET_SOKOBAN_RIGHT)
+		return false;
+
+	level_id = snap.id;
+	width = snap.w;
+	height = snap.h;
+	playerx = snap.player_x;
+	playery = snap.player_y;
+	player_asset = snap.facing;
+	warning = false;
+	clear_planes();
+	for (int y = 0, i = 0; y < height; ++y) {
+		for (int x = 0; x < width; ++x, ++i)
+			set_tile(LEVELIDX(x, y),
+				snap.tiles[i / 2] >> (i % 2 * 4) & 0xf);
+	}
+	if (is_wall(playerx, playery)
+		|| BITS_GET(PLANE(boxes), LEVELIDX(playerx, playery)))
+		return false;
+	find_live();
+	return true;
 }
@@ -1,34 +0,0 @@
-unsigned char sokoban_levels[989] =
-{
-    0x09,0x0a,0x07,0x04,0x03,0x02,0x00,0x5e,0x00,0x04,0x05,0x00,0x98,0x04,0x00,0x08,0x3b,0x00,0x0c,0x03,0x08,0xd5,0x00,0x04,0x03,0x7a,0x1c,0x08,0x08,0x5a,0x1d,0x11,
-    0xb9,0x17,0xc3,0x32,0x11,0x06,0x02,0x04,0x07,0x8f,0x00,0xe2,0x17,0xff,0x02,0x03,0x23,0x4e,0x96,0x0d,0xee,0x08,0x10,0x59,0x0a,0xd0,0x16,0x00,0x94,0x32,0x78,0x00,
-    0x08,0x09,0x03,0x4e,0x07,0x8c,0x13,0xd5,0x63,0x04,0x5f,0x41,0x0c,0x1e,0x72,0x10,0xdd,0x0f,0x6f,0xcd,0x13,0x07,0x76,0x2e,0xc6,0x11,0x46,0x54,0x0a,0x06,0xf8,0x08,
-    0x00,0xdb,0x12,0xe2,0x0b,0xfa,0x0b,0x01,0x98,0xfb,0x28,0xfd,0x39,0x00,0x67,0x6a,0x71,0x98,0x0d,0x09,0x09,0x44,0x04,0xcf,0x51,0x15,0xcb,0x02,0x3e,0x6b,0x08,0x04,
-    0x03,0x9e,0x11,0xe5,0x20,0x11,0x91,0x27,0x0c,0x57,0x01,0x60,0x1e,0xe8,0x19,0x76,0x06,0x06,0x11,0x61,0x13,0x03,0x77,0x5f,0x02,0x25,0x34,0x2e,0x4f,0x0c,0x61,0x49,
-    0x46,0x2c,0x79,0xa1,0xb9,0x57,0xd8,0x46,0x07,0xa4,0xa7,0x03,0x43,0x9a,0x42,0xc6,0x9b,0x6b,0x54,0x37,0xf9,0x2b,0x3f,0x64,0x35,0x3c,0xb1,0xb7,0x9e,0x70,0x5c,0x37,
-    0x86,0x2c,0xdb,0x23,0x0e,0x90,0x73,0x89,0xb9,0x07,0x83,0xcf,0x38,0xb9,0x01,0xc2,0xdf,0x79,0x28,0xc6,0x91,0x85,0x9f,0x06,0x0a,0x8d,0x9e,0x48,0x40,0xb6,0x55,0x3d,
-    0x38,0xd9,0x4b,0x06,0x25,0x11,0xc9,0x12,0x23,0x24,0x2d,0xd3,0x39,0x80,0xbc,0x07,0x0c,0x03,0xe7,0x21,0x12,0xb9,0x5c,0x4e,0xd0,0x60,0xb3,0x92,0x48,0x69,0x15,0xc6,
-    0xfa,0x58,0x58,0xa4,0x8f,0x8f,0x06,0x90,0x1a,0x09,0x08,0x22,0x03,0x01,0x4a,0xda,0xe6,0x3c,0x94,0x05,0x0c,0xda,0x42,0x41,0x0c,0x60,0xcb,0x88,0xf3,0x1e,0x08,0x78,
-    0x7f,0xc0,0xe2,0xa0,0xa3,0xa4,0xa4,0x92,0x0c,0x58,0x1c,0x89,0x2c,0x8a,0xb8,0x69,0x43,0x67,0x53,0xcd,0x59,0x92,0xa7,0x7c,0x2d,0xcb,0x22,0x8a,0xc2,0x7b,0x61,0x89,
-    0x49,0xa5,0x38,0xb0,0x2e,0x4b,0x21,0x7b,0x08,0x14,0xec,0x53,0x62,0x38,0xaa,0x02,0x47,0x09,0x9d,0x86,0x94,0xea,0xe1,0x95,0x24,0x0d,0xe1,0xc0,0x2c,0x0d,0x50,0xd4,
-    0xdc,0x0d,0xf7,0x28,0x39,0x12,0x83,0x42,0x0a,0x09,0x05,0x8a,0xd7,0x70,0xec,0x9e,0x5e,0x79,0x04,0xe7,0x69,0x32,0xee,0x48,0x01,0xf9,0x09,0x4f,0x66,0x7e,0xb7,0x04,
-    0x08,0xd1,0x2b,0xcd,0xe8,0x22,0xd5,0xcf,0x5c,0x14,0xff,0x57,0x31,0x32,0xc7,0x4f,0x5c,0x3a,0xbf,0x4e,0xba,0x15,0x21,0xce,0x11,0x90,0xb1,0x56,0x58,0xb2,0x04,0x04,
-    0x05,0xb3,0x46,0x45,0x4b,0xbc,0xba,0xbd,0x56,0x06,0x5c,0x45,0x07,0xd3,0x58,0x24,0x8f,0xab,0xaa,0x73,0x0c,0x84,0xe3,0x24,0x88,0xe4,0x08,0x05,0xcb,0xac,0x3a,0x96,
-    0x4d,0x5c,0x33,0xe4,0x49,0x31,0x33,0xaf,0x73,0x64,0xa5,0xa3,0x45,0x70,0x94,0x9d,0xdc,0x54,0x4b,0xed,0xc7,0x1b,0x8d,0x35,0xa6,0x37,0x30,0x32,0xa2,0xdd,0x22,0x4b,
-    0x28,0x8e,0x52,0x42,0x1a,0x6f,0xcb,0x81,0xf5,0x06,0x03,0x3c,0x58,0x44,0x6b,0xd1,0x7e,0x13,0xaa,0x63,0xb3,0x3b,0x80,0x4a,0xf3,0xd3,0xa4,0xfd,0xed,0xe8,0x39,0xcd,
-    0x45,0xbc,0x87,0xb0,0xfe,0x03,0x9e,0x16,0x32,0x7a,0xd6,0xb1,0x74,0x9d,0x9d,0xd6,0xa5,0x58,0x5d,0x04,0x76,0xca,0x00,0xa7,0x51,0x07,0xa5,0x12,0x56,0x0a,0x58,0x0a,
-    0xca,0xc7,0x8d,0xe1,0xcc,0x02,0xec,0x93,0x25,0xa9,0x4b,0x47,0x15,0x72,0x53,0x58,0x06,0xa7,0x4f,0xe7,0x53,0x94,0xdb,0xe7,0xb2,0x71,0x48,0x8f,0xc5,0xae,0x9b,0x3f,
-    0x03,0x89,0x5c,0x9a,0x9b,0xa6,0xd3,0x9d,0xa3,0xa7,0xc3,0xb9,0xa2,0xe2,0x59,0x4b,0xec,0x45,0xcc,0xfc,0x83,0x8f,0xd7,0x19,0xe2,0xda,0x50,0x8e,0x92,0x0b,0x58,0x40,
-    0xa7,0xfe,0xc2,0xf5,0x51,0xeb,0x9d,0x9a,0x25,0xbe,0x0b,0x5f,0x89,0xf1,0x2f,0x5d,0xcc,0x39,0x72,0x95,0x36,0xf3,0xee,0x09,0xc6,0xc5,0x6e,0x4b,0x5b,0x7b,0x53,0x16,
-    0x9c,0xed,0x51,0x08,0xe5,0xa6,0x3a,0x53,0x0a,0xf6,0xb5,0x68,0x63,0xc8,0xfd,0x8b,0x80,0x34,0x08,0xeb,0x93,0xc4,0x10,0x0d,0xaa,0x3d,0xef,0xcc,0x38,0xaf,0x71,0x37,
-    0xb3,0x15,0xa0,0x93,0xde,0x73,0x49,0xf0,0x71,0x63,0x8f,0x3f,0x19,0x3b,0x34,0x39,0x97,0x07,0xce,0xb5,0x6a,0x32,0xfc,0xc5,0x14,0x81,0xd3,0x05,0x1f,0x3f,0x09,0x07,
-    0x9e,0x45,0x8c,0x87,0x57,0x29,0x49,0x3e,0xa5,0x4b,0xd3,0x36,0xc1,0x11,0x2f,0x8f,0x12,0x9e,0x19,0xe4,0x22,0x03,0xea,0x9c,0x79,0xda,0x92,0x41,0x5b,0x3a,0xce,0x99,
-    0x6e,0x0d,0x21,0xe7,0x12,0x6f,0xc6,0xb2,0xee,0xd3,0x2d,0xdc,0x13,0x04,0x5c,0x09,0x64,0xb3,0x09,0x44,0x55,0xdd,0xe6,0xb4,0xf2,0xef,0xba,0x2e,0x91,0x45,0x44,0xe3,
-    0xd1,0x35,0xc2,0xb6,0x08,0xa8,0x99,0x9a,0x0a,0x2b,0x4d,0x46,0x96,0x0d,0xe7,0x09,0xf6,0xe9,0x6e,0x10,0x7d,0x52,0xb5,0x9e,0x30,0x6b,0x56,0x6e,0xb8,0x4b,0xef,0xbc,
-    0xb6,0x8f,0x9e,0x59,0x5b,0x4b,0x32,0x96,0x53,0x22,0xbe,0x65,0x4b,0x9e,0x33,0x74,0x4b,0x01,0x53,0x85,0x45,0x54,0x92,0x99,0x3b,0xc3,0x4b,0x54,0xcf,0x3a,0xc1,0x72,
-    0x4f,0x5a,0xb3,0x71,0xa2,0x4b,0x0a,0x06,0x06,0x6c,0xcc,0x89,0xfe,0x98,0xbd,0x96,0x94,0x90,0xb0,0xa7,0x9c,0x9e,0x65,0x08,0x89,0x30,0x22,0x08,0x07,0xe5,0x0d,0x33,
-    0xb2,0xbb,0xe7,0x00,0xd1,0x28,0xa5,0xd3,0x96,0x03,0x2a,0xcf,0x51,0x03,0x4d,0xf6,0x12,0x1a,0x04,0x9a,0x08,0xe6,0x78,0x65,0x96,0x89,0xee,0xac,0x27,0x3d,0x8e,0x9e,
-    0x8d,0x9a,0x97,0x07,0x1a,0x17,0xee,0xd3,0xac,0xb1,0xe1,0x84,0x73,0x55,0x0f,0x9a,0x07,0x3c,0xc7,0xf1,0x61,0xdf,0xaa,0x34,0x3c,0xd3,0xc5,0x2c,0x24,0x66,0x8c,0xc9,
-    0x29,0x2a,0x32,0x0c,0xe7,0x01,0xd2,0x79,0xaa,0x79,0x58,0x2e,0x22,0x70,0xd8,0x89,0xb0,0x14,0x08,0x4d,0x9a,0x4f,0x58,0x7c,0x15,0x6a,0xed,0xc1,0x3c,0x64,0xb9,0xa6,
-    0x71,0x57,0xe6,0xcc,0x09,0x8a,0x43,0x9e,0x44,0x56,0xb3,0x9e,0xdd,0x53,0x04,0x0c,0xbb,0xa1,0x8b,0x30,0x86,0xce,0x8a,0x51,0x91,0x86,0x00,0x00,0x80
-};
@@ -1,2 +0,0 @@
-#include <stdint.h>
-uint16_t sokoban_level_table[] = {0,67,173,249,313,398,466,533,601,686,774,850,917,985,1073,1167,1252,1346,1422,1498,1592,1677,1781,1841,1935,2019,2123,2199,2266,2326,2430,2506,2582,2658,2722,2782,2858,2942,3027,3095};
\ No newline at end of file
@@ -17,7 +17,6 @@ extern "C" {
 #include "sprite_snake.h"
 #include "sprite_sokoban_down.h"
 #include "sprite_sokoban_left.h"
-#include "sprite_sokoban_right.h"
 #include "sprite_sokoban_wall.h"
 
 #ifdef __cplusplus
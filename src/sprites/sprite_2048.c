@@ -1,36 +1,7 @@
-unsigned char sprite_2048_data[1026] =
+unsigned char sprite_2048_compressed[120] =
 {
-    0x20,0x20,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-    0x01,0x01,0x01,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x19,0x19,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x19,0x19,0x19,0x19,0x19,0x02,0x02,0x02,0x02,0x02,0x02,0x19,0x19,0x19,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x02,0x02,0x19,0x19,0x19,0x02,0x02,0x19,0x19,0x19,0x19,0x02,0x02,0x19,0x19,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x02,0x19,0x19,0x02,0x02,0x19,0x19,0x19,0x19,0x19,0x19,0x02,0x02,0x19,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x02,0x19,0x19,0x02,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x02,0x19,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x02,0x02,0x19,0x19,0x02,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x02,0x19,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x19,0x19,0x19,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x19,0x19,0x19,0x02,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x02,0x19,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x19,0x19,0x02,0x02,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x02,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x02,0x19,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x19,0x19,0x02,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x02,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x02,0x19,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x19,0x19,0x02,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x02,0x02,0x19,0x19,0x19,0x19,0x19,0x19,0x02,0x02,0x19,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x19,0x19,0x02,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x02,0x02,0x19,0x19,0x19,0x19,0x02,0x02,0x19,0x19,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x19,0x19,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x19,0x19,0x19,0x19,0x02,0x02,0x02,0x02,0x02,0x02,0x19,0x19,0x19,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x19,0x19,0x02,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x02,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x19,0x19,0x02,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x02,0x19,0x19,0x19,0x19,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x19,0x19,0x19,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x19,0x19,0x02,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x02,0x19,0x19,0x19,0x02,0x02,0x19,0x19,0x19,0x19,0x19,0x02,0x02,0x19,0x19,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x19,0x19,0x02,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x02,0x19,0x19,0x19,0x02,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x02,0x19,0x19,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x19,0x19,0x02,0x02,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x02,0x19,0x19,0x19,0x02,0x02,0x19,0x19,0x19,0x19,0x19,0x02,0x02,0x19,0x19,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x19,0x19,0x19,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x19,0x19,0x19,0x19,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x19,0x19,0x19,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x02,0x19,0x19,0x19,0x02,0x02,0x19,0x19,0x19,0x19,0x19,0x02,0x02,0x19,0x19,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x02,0x19,0x19,0x19,0x02,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x02,0x19,0x19,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x02,0x19,0x19,0x19,0x02,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x02,0x19,0x19,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x02,0x19,0x19,0x19,0x02,0x02,0x19,0x19,0x19,0x19,0x19,0x02,0x02,0x19,0x19,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x02,0x19,0x19,0x19,0x19,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x19,0x19,0x19,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
-    0x02,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-    0x01,0x01
+    0x20,0x21,0x20,0x01,0xf4,0x00,0x02,0x39,0x00,0x04,0x68,0x1f,0x19,0x62,0x00,0x79,0x1f,0xe6,0x2d,0x2b,0x88,0x0a,0x84,0x26,0x3f,0x15,0x9e,0x0a,0x11,0x5f,0x92,0x14,
+    0x78,0x2b,0x5a,0x1f,0x22,0x0b,0x12,0x5f,0x85,0xa2,0x1f,0x42,0x9f,0x14,0x1f,0x89,0x43,0x85,0x90,0x1f,0x19,0x57,0x1f,0x38,0xbf,0x42,0x90,0x1f,0xa0,0xff,0x45,0x0c,
+    0xf0,0x60,0xbf,0xc1,0x40,0xff,0xc4,0x41,0x10,0x14,0x1f,0xf0,0x6d,0xbc,0x1f,0x41,0xc4,0x42,0xd3,0x1f,0xc6,0x0c,0x04,0xbf,0x2d,0x3f,0x1e,0xff,0x30,0xb7,0x7f,0x00,
+    0x0f,0x42,0x3f,0x90,0x7f,0xfc,0x1f,0x1b,0x70,0x5f,0x04,0x56,0xff,0x30,0xfc,0x1f,0x1f,0xac,0xff,0x3f,0x00,0x00,0x00,0x80
 };
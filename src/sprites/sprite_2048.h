@@ -8,8 +8,8 @@ extern "C" {
 #define sprite_2048_width 32
 #define sprite_2048_height 32
 #define sprite_2048_size 1026
-#define sprite_2048 ((gfx_sprite_t*)sprite_2048_data)
-extern unsigned char sprite_2048_data[1026];
+#define sprite_2048_compressed_size 120
+extern unsigned char sprite_2048_compressed[120];
 
 #ifdef __cplusplus
 }
@@ -1,36 +1,6 @@
-unsigned char sprite_snake_data[1026] =
+unsigned char sprite_snake_compressed[69] =
 {
-    0x20,0x20,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-    0x01,0x01,0x01,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x16,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x02,0x02,0x02,0x02,0x16,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x02,0x02,0x02,0x16,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x02,0x02,0x02,0x16,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x02,0x02,0x02,0x16,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x02,0x02,0x02,0x16,0x02,0x02,0x02,0x02,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x02,0x02,0x02,0x02,0x02,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x02,0x02,0x02,0x16,0x02,0x02,0x02,0x02,0x16,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x16,0x02,0x02,0x02,0x02,0x02,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x02,0x02,0x02,0x16,0x02,0x02,0x02,0x02,0x16,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x16,0x02,0x02,0x02,0x02,0x02,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x02,0x02,0x02,0x16,0x02,0x02,0x02,0x02,0x16,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x16,0x02,0x02,0x02,0x02,0x02,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x02,0x02,0x02,0x16,0x02,0x02,0x02,0x02,0x16,0x02,0x02,0x14,0x14,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x16,0x02,0x02,0x02,0x02,0x02,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x02,0x02,0x02,0x16,0x02,0x02,0x02,0x02,0x16,0x02,0x02,0x14,0x14,0x02,0x18,0x02,0x02,0x02,0x02,0x02,0x16,0x02,0x02,0x02,0x02,0x02,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x02,0x02,0x02,0x16,0x02,0x02,0x02,0x02,0x16,0x02,0x02,0x02,0x02,0x02,0x02,0x18,0x02,0x02,0x02,0x02,0x16,0x02,0x02,0x02,0x02,0x02,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x02,0x02,0x02,0x16,0x02,0x02,0x02,0x02,0x16,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x16,0x02,0x02,0x02,0x16,0x02,0x02,0x02,0x02,0x02,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x02,0x02,0x02,0x16,0x02,0x02,0x02,0x02,0x16,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x16,0x02,0x02,0x02,0x16,0x02,0x02,0x02,0x02,0x02,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x02,0x02,0x02,0x16,0x02,0x02,0x02,0x02,0x16,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x16,0x02,0x02,0x02,0x16,0x02,0x02,0x02,0x02,0x02,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x02,0x02,0x02,0x16,0x02,0x02,0x02,0x02,0x16,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x16,0x02,0x02,0x02,0x16,0x02,0x02,0x02,0x02,0x02,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x02,0x02,0x02,0x16,0x02,0x02,0x02,0x02,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x02,0x02,0x02,0x16,0x02,0x02,0x02,0x02,0x02,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x02,0x02,0x02,0x16,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x16,0x02,0x02,0x02,0x02,0x02,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x02,0x02,0x02,0x16,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x16,0x02,0x02,0x02,0x02,0x02,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x02,0x02,0x02,0x16,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x16,0x02,0x02,0x02,0x02,0x02,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x02,0x02,0x02,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x02,0x02,0x02,0x02,0x02,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
-    0x02,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-    0x01,0x01
+    0x20,0x21,0x20,0x01,0xf4,0x00,0x02,0x39,0x00,0x02,0x42,0x1f,0x16,0x1d,0x1f,0x43,0x16,0xbc,0x3f,0x1e,0x0c,0x48,0x1f,0x16,0xb8,0x00,0xe8,0x1f,0xf8,0x44,0x15,0x88,
+    0x1f,0x14,0x14,0x20,0x1f,0x43,0x18,0xe8,0x5f,0x18,0x7d,0x7f,0x16,0x03,0xbc,0x1f,0xf7,0x00,0x0b,0x0d,0x94,0x9f,0x0a,0x50,0x1f,0x84,0x00,0x3e,0xbf,0x90,0x14,0xf0,
+    0x1f,0xfc,0x00,0x00,0x02
 };
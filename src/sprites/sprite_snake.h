@@ -8,8 +8,8 @@ extern "C" {
 #define sprite_snake_width 32
 #define sprite_snake_height 32
 #define sprite_snake_size 1026
-#define sprite_snake ((gfx_sprite_t*)sprite_snake_data)
-extern unsigned char sprite_snake_data[1026];
+#define sprite_snake_compressed_size 69
+extern unsigned char sprite_snake_compressed[69];
 
 #ifdef __cplusplus
 }
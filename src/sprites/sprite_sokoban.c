@@ -1,36 +1,8 @@
-unsigned char sprite_sokoban_data[1026] =
+unsigned char sprite_sokoban_compressed[138] =
 {
-    0x20,0x20,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-    0x01,0x01,0x01,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x01,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x01,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x01,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x01,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x01,0x02,0x02,0x02,0x02,0x02,0x01,0x02,0x01,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x01,0x02,0x02,0x02,0x01,0x02,0x02,0x02,0x01,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x01,0x02,0x01,0x02,0x15,0x02,0x02,0x01,0x01,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x01,0x02,0x01,0x01,0x15,0x01,0x01,0x15,0x01,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x01,0x02,0x02,0x02,0x15,0x02,0x02,0x15,0x01,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x01,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x01,0x02,0x02,0x02,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x15,0x01,0x02,0x02,0x02,0x01,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x01,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x01,0x02,0x02,0x02,0x02,0x02,0x02,0x01,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x01,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x02,0x02,0x02,0x02,0x15,0x01,0x02,0x02,0x02,0x02,0x02,0x01,0x01,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x01,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x02,0x02,0x02,0x02,0x01,0x02,0x02,0x02,0x02,0x01,0x01,0x02,0x01,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x01,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x02,0x02,0x02,0x02,0x01,0x02,0x01,0x01,0x01,0x15,0x02,0x02,0x01,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x01,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x02,0x02,0x02,0x01,0x01,0x01,0x02,0x02,0x02,0x02,0x02,0x02,0x01,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x01,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x02,0x02,0x15,0x01,0x02,0x02,0x01,0x01,0x01,0x01,0x02,0x02,0x01,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x01,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x02,0x02,0x02,0x01,0x02,0x02,0x02,0x02,0x02,0x02,0x01,0x01,0x01,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x01,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x02,0x02,0x01,0x02,0x02,0x02,0x02,0x02,0x02,0x15,0x02,0x02,0x01,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x01,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x02,0x02,0x01,0x15,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x01,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x01,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x02,0x01,0x02,0x02,0x02,0x01,0x01,0x02,0x02,0x02,0x02,0x02,0x01,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x01,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x02,0x01,0x01,0x01,0x01,0x02,0x01,0x02,0x02,0x02,0x02,0x02,0x01,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x01,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x02,0x01,0x02,0x02,0x02,0x01,0x02,0x02,0x02,0x02,0x02,0x02,0x01,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x01,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x01,0x02,0x02,0x02,0x02,0x01,0x02,0x02,0x02,0x15,0x02,0x02,0x01,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x01,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x01,0x02,0x02,0x15,0x02,0x01,0x02,0x02,0x02,0x02,0x02,0x02,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x02,
-    0x02,0x01,0x01,0x02,0x01,0x02,0x02,0x02,0x02,0x01,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x02,0x02,0x02,0x15,0x01,0x02,0x02,0x02,0x15,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
-    0x02,0x01,0x01,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
-    0x02,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-    0x01,0x01
+    0x20,0x21,0x20,0x01,0xf4,0x00,0x02,0x39,0x00,0x70,0x1f,0xdd,0x2a,0xcf,0x14,0x17,0x07,0xa8,0x1f,0x01,0x71,0x1f,0x01,0x0e,0x6a,0x3f,0x01,0x15,0x06,0x86,0x8a,0x1f,
+    0x01,0x15,0x02,0x86,0xfe,0x5f,0x3f,0x02,0x08,0xc2,0xbf,0x34,0xbb,0x63,0x07,0x9f,0x3f,0xb4,0x1f,0x16,0x55,0x00,0xc5,0x1b,0xc3,0x3c,0x33,0x1f,0xa1,0x7c,0x01,0x7b,
+    0x1f,0x06,0xb8,0x0c,0x66,0x1f,0xc2,0x81,0x18,0x5f,0xe1,0x06,0xc4,0x7f,0x15,0xc1,0xc5,0x0c,0x4f,0x3f,0x3d,0x0a,0x84,0x9f,0xf0,0x1e,0xc5,0x7f,0x84,0x99,0x31,0x7f,
+    0x38,0xd8,0xc3,0x56,0x1f,0x9a,0x10,0xdc,0x1f,0x3a,0xdf,0x31,0x00,0xa2,0x15,0x86,0x3b,0x1f,0x19,0x1f,0x85,0x0a,0xdf,0x68,0x3e,0x69,0x9f,0x6e,0x59,0x48,0x5e,0x5e,
+    0x1f,0x78,0x00,0x14,0xe1,0x1f,0xf8,0x00,0x00,0x04
 };
@@ -8,8 +8,8 @@ extern "C" {
 #define sprite_sokoban_width 32
 #define sprite_sokoban_height 32
 #define sprite_sokoban_size 1026
-#define sprite_sokoban ((gfx_sprite_t*)sprite_sokoban_data)
-extern unsigned char sprite_sokoban_data[1026];
+#define sprite_sokoban_compressed_size 138
+extern unsigned char sprite_sokoban_compressed[138];
 
 #ifdef __cplusplus
 }
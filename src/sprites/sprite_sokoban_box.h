@@ -8,8 +8,8 @@ extern "C" {
 #define sprite_sokoban_box_width 16
 #define sprite_sokoban_box_height 16
 #define sprite_sokoban_box_size 258
-#define sprite_sokoban_box ((gfx_sprite_t*)sprite_sokoban_box_data)
-extern unsigned char sprite_sokoban_box_data[258];
+#define sprite_sokoban_box_compressed_size 52
+extern unsigned char sprite_sokoban_box_compressed[52];
 
 #ifdef __cplusplus
 }
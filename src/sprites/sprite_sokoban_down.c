@@ -1,12 +1,5 @@
-unsigned char sprite_sokoban_down_data[258] =
+unsigned char sprite_sokoban_down_compressed[63] =
 {
-    0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x06,0x06,0x06,0x01,0x01,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x01,0x01,0x06,0x06,0x06,0x06,0x06,0x06,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x01,0x01,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x01,0x06,0x06,0x01,0x06,0x06,0x01,0x06,0x06,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x01,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x01,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x06,0x06,0x06,0x06,0x06,0x01,0x06,0x06,0x01,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x01,0x06,0x06,0x01,0x06,0x06,0x01,0x06,0x06,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x06,0x06,0x01,0x01,0x01,0x01,0x06,0x01,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x06,0x06,0x06,0x06,0x06,0x06,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x06,0x06,0x06,0x06,0x01,0x01,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x06,0x06,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x06,0x01,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00
+    0x10,0x2d,0x10,0x00,0x00,0x01,0x52,0x00,0x4e,0x08,0x0d,0x06,0xe2,0x00,0x2e,0x11,0x0d,0xe7,0x00,0x0f,0x9a,0x0e,0xe7,0x20,0x0f,0x9a,0x02,0x32,0x1f,0x3a,0x0f,0x3e,
+    0x10,0xe1,0x30,0x9b,0x40,0x90,0x0a,0x0e,0x8c,0x71,0x8a,0x0f,0xe7,0x10,0x7f,0x9e,0x10,0x33,0x0e,0x00,0x96,0x3d,0x32,0x10,0x35,0x0f,0x00,0x3c,0x0e,0x00,0x02
 };
@@ -8,8 +8,8 @@ extern "C" {
 #define sprite_sokoban_down_width 16
 #define sprite_sokoban_down_height 16
 #define sprite_sokoban_down_size 258
-#define sprite_sokoban_down ((gfx_sprite_t*)sprite_sokoban_down_data)
-extern unsigned char sprite_sokoban_down_data[258];
+#define sprite_sokoban_down_compressed_size 63
+extern unsigned char sprite_sokoban_down_compressed[63];
 
 #ifdef __cplusplus
 }
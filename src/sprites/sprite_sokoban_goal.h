@@ -8,8 +8,8 @@ extern "C" {
 #define sprite_sokoban_goal_width 16
 #define sprite_sokoban_goal_height 16
 #define sprite_sokoban_goal_size 258
-#define sprite_sokoban_goal ((gfx_sprite_t*)sprite_sokoban_goal_data)
-extern unsigned char sprite_sokoban_goal_data[258];
+#define sprite_sokoban_goal_compressed_size 30
+extern unsigned char sprite_sokoban_goal_compressed[30];
 
 #ifdef __cplusplus
 }
@@ -1,12 +1,5 @@
-unsigned char sprite_sokoban_gold_box_data[258] =
+unsigned char sprite_sokoban_gold_box_compressed[52] =
 {
-    0x10,0x10,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,
-    0x01,0x01,0x01,0x1a,0x01,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x01,0x1a,0x01,0x01,0x1a,0x1a,0x01,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x01,0x1a,
-    0x1a,0x01,0x01,0x1a,0x1a,0x1a,0x01,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x01,0x1a,0x1a,0x1a,0x01,0x01,0x1a,0x1a,0x1a,0x1a,0x01,0x1a,0x1a,0x1a,0x1a,0x01,0x1a,0x1a,0x1a,
-    0x1a,0x01,0x01,0x1a,0x1a,0x1a,0x1a,0x1a,0x01,0x1a,0x1a,0x01,0x1a,0x1a,0x1a,0x1a,0x1a,0x01,0x01,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x01,0x01,0x1a,0x1a,0x1a,0x1a,0x1a,
-    0x1a,0x01,0x01,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x01,0x01,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x01,0x01,0x1a,0x1a,0x1a,0x1a,0x1a,0x01,0x1a,0x1a,0x01,0x1a,0x1a,0x1a,0x1a,
-    0x1a,0x01,0x01,0x1a,0x1a,0x1a,0x1a,0x01,0x1a,0x1a,0x1a,0x1a,0x01,0x1a,0x1a,0x1a,0x1a,0x01,0x01,0x1a,0x1a,0x1a,0x01,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x01,0x1a,0x1a,
-    0x1a,0x01,0x01,0x1a,0x1a,0x01,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x01,0x1a,0x1a,0x01,0x01,0x1a,0x01,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x01,
-    0x1a,0x01,0x01,0x01,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-    0x01,0x01
+    0x10,0x21,0x10,0x01,0x04,0x00,0x1a,0x55,0x00,0xc5,0x0e,0x77,0x10,0x0a,0x1e,0x3d,0x10,0xdc,0x08,0x0f,0xf7,0x10,0x06,0x2c,0x3e,0x4c,0x04,0xd3,0x4e,0xdc,0x35,0x0f,
+    0x3b,0x07,0x1f,0x2f,0x1f,0x4f,0x1f,0x6f,0x1e,0x8f,0x11,0xe1,0xaf,0x1e,0xcf,0x11,0xf0,0x00,0x00,0x08
 };
@@ -1,12 +1,5 @@
-unsigned char sprite_sokoban_left_data[258] =
+unsigned char sprite_sokoban_left_compressed[59] =
 {
-    0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x06,0x06,0x01,0x01,0x01,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x06,0x06,0x06,0x06,0x06,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x06,0x06,0x06,0x06,0x06,0x01,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x06,0x06,0x01,0x06,0x01,0x06,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x06,0x06,0x06,0x06,0x06,0x06,0x01,
-    0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x06,0x06,0x06,0x06,0x06,0x06,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x06,0x06,0x06,0x06,0x06,0x01,0x06,0x06,0x06,0x01,
-    0x00,0x00,0x00,0x00,0x00,0x01,0x06,0x06,0x01,0x06,0x01,0x01,0x06,0x06,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x06,0x06,0x01,0x01,0x01,0x06,0x06,0x06,0x01,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x01,0x06,0x06,0x06,0x06,0x06,0x06,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x06,0x06,0x06,0x06,0x06,0x01,0x01,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00
+    0x10,0x21,0x10,0x00,0x64,0x00,0x01,0x77,0x0e,0x00,0x1a,0x0f,0x06,0x46,0x06,0x77,0x12,0x0f,0x00,0xcf,0x10,0x0e,0x1d,0x0f,0x77,0x2e,0x01,0x1b,0x2e,0xcf,0x0f,0x5b,
+    0x3c,0x0f,0x5d,0x4b,0xc5,0x03,0x49,0x3c,0x71,0x15,0x7b,0x71,0x1e,0xb5,0x4c,0x1e,0x17,0x3f,0x13,0x6c,0x24,0x00,0x2c,0xe7,0x10,0x00,0x08
 };
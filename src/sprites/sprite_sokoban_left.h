@@ -8,8 +8,8 @@ extern "C" {
 #define sprite_sokoban_left_width 16
 #define sprite_sokoban_left_height 16
 #define sprite_sokoban_left_size 258
-#define sprite_sokoban_left ((gfx_sprite_t*)sprite_sokoban_left_data)
-extern unsigned char sprite_sokoban_left_data[258];
+#define sprite_sokoban_left_compressed_size 59
+extern unsigned char sprite_sokoban_left_compressed[59];
 
 #ifdef __cplusplus
 }
@@ -1,12 +0,0 @@
-unsigned char sprite_sokoban_right_data[258] =
-{
-    0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x06,0x06,0x01,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x01,0x06,0x06,0x06,0x06,0x06,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x06,0x06,0x06,0x06,0x06,0x01,0x01,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x01,0x06,0x01,0x06,0x01,0x06,0x06,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x06,0x06,0x06,0x06,0x06,0x06,0x01,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x01,0x06,0x06,0x06,0x06,0x06,0x06,0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x06,0x06,0x06,0x01,0x06,0x06,0x06,0x06,0x06,0x01,0x00,
-    0x00,0x00,0x00,0x00,0x01,0x01,0x06,0x06,0x01,0x01,0x06,0x01,0x06,0x06,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x06,0x06,0x06,0x01,0x01,0x01,0x06,0x06,0x01,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x06,0x06,0x06,0x06,0x06,0x06,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x06,0x06,0x06,0x06,0x06,0x01,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00
-};
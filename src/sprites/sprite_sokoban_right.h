@@ -1,18 +0,0 @@
-#ifndef sprite_sokoban_right_include_file
-#define sprite_sokoban_right_include_file
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-#define sprite_sokoban_right_width 16
-#define sprite_sokoban_right_height 16
-#define sprite_sokoban_right_size 258
-#define sprite_sokoban_right ((gfx_sprite_t*)sprite_sokoban_right_data)
-extern unsigned char sprite_sokoban_right_data[258];
-
-#ifdef __cplusplus
-}
-#endif
-
-#endif
@@ -8,8 +8,8 @@ extern "C" {
 #define sprite_sokoban_up_width 16
 #define sprite_sokoban_up_height 16
 #define sprite_sokoban_up_size 258
-#define sprite_sokoban_up ((gfx_sprite_t*)sprite_sokoban_up_data)
-extern unsigned char sprite_sokoban_up_data[258];
+#define sprite_sokoban_up_compressed_size 50
+extern unsigned char sprite_sokoban_up_compressed[50];
 
 #ifdef __cplusplus
 }
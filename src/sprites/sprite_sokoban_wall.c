@@ -1,12 +1,5 @@
-unsigned char sprite_sokoban_wall_data[258] =
+unsigned char sprite_sokoban_wall_compressed[36] =
 {
-    0x10,0x10,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x01,0x01,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x01,0x01,0x17,0x17,0x17,
-    0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x01,0x01,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x01,0x01,0x17,0x17,0x17,
-    0x17,0x17,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x17,0x17,0x17,0x17,0x01,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,
-    0x17,0x17,0x17,0x17,0x17,0x17,0x01,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x01,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,
-    0x17,0x17,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x01,0x01,0x17,0x17,0x17,0x17,0x17,
-    0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x01,0x01,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x01,0x01,0x17,0x17,0x17,0x17,0x17,
-    0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x01,0x01,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-    0x01,0x01,0x17,0x17,0x01,0x01,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x01,0x01,0x17,0x17,0x17,0x17,0x01,0x01,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x01,0x01,
-    0x17,0x17
+    0x10,0x27,0x10,0x17,0x00,0x24,0x01,0x01,0x06,0x82,0xf4,0x0f,0x01,0x75,0x00,0xc5,0x13,0xc3,0x29,0xf1,0x0f,0xf0,0x3f,0x70,0x8d,0x10,0xc7,0x4f,0x03,0x17,0x24,0x1f,
+    0x0f,0x00,0x00,0x80
 };
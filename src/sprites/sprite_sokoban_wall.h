@@ -8,8 +8,8 @@ extern "C" {
 #define sprite_sokoban_wall_width 16
 #define sprite_sokoban_wall_height 16
 #define sprite_sokoban_wall_size 258
-#define sprite_sokoban_wall ((gfx_sprite_t*)sprite_sokoban_wall_data)
-extern unsigned char sprite_sokoban_wall_data[258];
+#define sprite_sokoban_wall_compressed_size 36
+extern unsigned char sprite_sokoban_wall_compressed[36];
 
 #ifdef __cplusplus
 }
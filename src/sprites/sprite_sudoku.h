@@ -8,8 +8,8 @@ extern "C" {
 #define sprite_sudoku_width 32
 #define sprite_sudoku_height 32
 #define sprite_sudoku_size 1026
-#define sprite_sudoku ((gfx_sprite_t*)sprite_sudoku_data)
-extern unsigned char sprite_sudoku_data[1026];
+#define sprite_sudoku_compressed_size 108
+extern unsigned char sprite_sudoku_compressed[108];
 
 #ifdef __cplusplus
 }
@@ -1,25 +1,42 @@
 #include <graphx.h>
 #include <tice.h>
-#include <sys/util.h>
 
 #include <stdbool.h>
 #include <string.h>
 
 #include "common.h"
 
-#define curx share.sudoku_bss.curx
-#define cury share.sudoku_bss.cury
-#define tiles share.sudoku_bss.tiles
-#define tiles_initial share.sudoku_bss.tiles_initial
-#define candidate_set share.sudoku_bss.candidate_set
-
-extern union Shared share;
+static struct {
+	uint8_t tiles[SUDOKU_GRID_WH][SUDOKU_GRID_WH];
+	const uint8_t *tiles_initial;
+	// The boards in the MASUDDAT AppVar.
+	const struct SudokuData *pack;
+	uint8_t board_index;
+	uint24_t curx, cury;
+	// Bit n is set if n can be placed in the cell, 0 meaning erasing it.
+	uint16_t candidate_set[SUDOKU_GRID_WH][SUDOKU_GRID_WH];
+	// The digits of the board in black and the ones typed in in red.
+	const struct Glyphs *given_glyphs, *placed_glyphs;
+} *bss;
+
+#define curx bss->curx
+#define cury bss->cury
+#define tiles bss->tiles
+#define tiles_initial bss->tiles_initial
+#define board_index bss->board_index
+#define pack bss->pack
+#define candidate_set bss->candidate_set
+#define given_glyphs bss->given_glyphs
+#define placed_glyphs bss->placed_glyphs
 
 static void draw(void);
+static void draw_grid(void);
 static bool validate_num_insert_at_cur(int n);
 static void load_random_board(void);
 static void update_candidate_set(void);
 static void change_candidate_set_at_cur(int n, bool presence);
+static void save_snapshot(void);
+static bool load_snapshot(void);
 
 static inline void try_dec_coord(uint24_t *);
 static inline void try_inc_coord(uint24_t *);
@@ -30,9 +47,39 @@ static inline void try_inc_coord(uint24_t *);
 #define SQUARE_LRMARGIN ((LCD_WIDTH - LCD_HEIGHT) / 2)
 #define CELL_WIDTH (LCD_HEIGHT / 9)
 
-#define NUM_SUDOKU_BOARDS 32
+#define N_CELLS (SUDOKU_GRID_WH * SUDOKU_GRID_WH)
+
+/* The first row or column of the box a row or column is in, and where the
+ * i-th cell of a box is relative to its first one. They stand in for the
+ * divisions by 3, which the eZ80 does in software.
+ */
+static const uint8_t box_start[SUDOKU_GRID_WH] = {0, 0, 0, 3, 3, 3, 6, 6, 6};
+static const uint8_t box_dy[SUDOKU_GRID_WH] = {0, 0, 0, 1, 1, 1, 2, 2, 2};
+static const uint8_t box_dx[SUDOKU_GRID_WH] = {0, 1, 2, 0, 1, 2, 0, 1, 2};
+
+/* The layout of the MASUDDAT AppVar, which is made by sudoku_pack.py. A 0
+ * is a blank cell.
+ */
+struct SudokuData {
+	uint8_t n_boards;
+	uint8_t boards[][N_CELLS];
+};
 
-#define CELL_NUM_PADDING ((CELL_WIDTH - 8) / 2)
+/* The candidate set is saved as well, since it is updated incrementally and
+ * can't always be told from the tiles.
+ */
+struct Snapshot {
+	uint8_t board;
+	uint8_t cursor_x, cursor_y;
+	// Two tiles per byte.
+	uint8_t digits[(N_CELLS + 1) / 2];
+	// One bit per cell and number from 1 to 9.
+	uint8_t candidates[BITS_BYTES(N_CELLS * 9)];
+};
+
+// The digits on the board are drawn twice their size.
+#define CELL_NUM_SCALE 2
+#define CELL_NUM_PADDING ((CELL_WIDTH - GLYPH_SIZE * CELL_NUM_SCALE) / 2)
 
 // The amount of pixels on the left/right
 #define BOX_THICKNESS 2
@@ -41,23 +88,12 @@ static inline void try_inc_coord(uint24_t *);
 // How many pixels need to be subtracted from the lines due to integer divison.
 #define MAGIC_INTEGER_ERR 7
 
-static void draw(void)
+/* The grid never changes during a game, so it is kept as the background
+ * layer and draw() only has to draw the cursor, the tip bar and the digits.
+ */
+static void draw_grid(void)
 {
-	gfx_FillScreen(WHITE);
-
-	gfx_SetColor(GRAY1);
-	gfx_FillRectangle(SQUARE_LRMARGIN*2 + curx * CELL_WIDTH + 1,
-		cury * CELL_WIDTH + 1, CELL_WIDTH - 1, CELL_WIDTH - 1);
 	gfx_SetColor(BLACK);
-	gfx_SetTextFGColor(BLACK);
-
-	// Handy tip bar on the left of numbers they can place at the cursor.
-	for (int i = 1; i <= 9; ++i) {
-		if (tiles[cury][curx] == 0 && candidate_set[cury][curx][i]) {
-			gfx_SetTextXY(5, 5 + i * CHAR_HEIGHT);
-			gfx_PrintChar('0' + i);
-		}
-	}
 
 	for (int i = 0; i <= 9; ++i) {
 		/* The offset uses the smaller dimension, which in this
@@ -83,44 +119,88 @@ static void draw(void)
 			BOX_THICKNESS * 2, LCD_HEIGHT + BOX_THICKNESS * 2
 			- MAGIC_INTEGER_ERR - 1);
 	}
+}
 
+static void draw(void)
+{
+	g_layer_restore();
+
+	/* The cursor goes below the grid since the thick lines overlap the
+	 * cells by a pixel.
+	 */
+	int cursor_px = SQUARE_LRMARGIN*2 + curx * CELL_WIDTH + 1;
+	int cursor_py = cury * CELL_WIDTH + 1;
+	gfx_SetColor(GRAY1);
+	gfx_FillRectangle(cursor_px, cursor_py, CELL_WIDTH - 1, CELL_WIDTH - 1);
+	g_layer_redraw(cursor_px, cursor_py, CELL_WIDTH - 1, CELL_WIDTH - 1);
+	g_layer_dirty(cursor_px, cursor_py, CELL_WIDTH - 1, CELL_WIDTH - 1);
+
+	// Handy tip bar on the left of numbers they can place at the cursor.
+	for (int i = 1; i <= 9; ++i) {
+		if (tiles[cury][curx] == 0
+			&& candidate_set[cury][curx] >> i & 1)
+			glyphs_digit(given_glyphs, i, 5, 5 + i * CHAR_HEIGHT, 1);
+	}
+	g_layer_dirty(5, 5 + CHAR_HEIGHT, 8, 9 * CHAR_HEIGHT);
+
+	/* Only the cell under the cursor can change and it is restored every
+	 * frame, so the other digits can be drawn over themselves.
+	 */
 	for (int y = 0; y < 9; ++y) {
 		for (int x = 0; x < 9; ++x) {
 			if (tiles[y][x] == 0)
 				continue;
-			char digit = '0' + tiles[y][x];
-			gfx_SetTextFGColor(
+			glyphs_digit(
 				(tiles_initial[y * SUDOKU_GRID_WH + x] == 0) ?
-				RED : BLACK);
-			gfx_SetTextXY(x * CELL_WIDTH
-				+ SQUARE_LRMARGIN * 2 + CELL_NUM_PADDING,
-				y * CELL_WIDTH + CELL_NUM_PADDING);
-			gfx_PrintChar(digit);
+				placed_glyphs : given_glyphs,
+				tiles[y][x],
+				x * CELL_WIDTH + SQUARE_LRMARGIN * 2
+				+ CELL_NUM_PADDING,
+				y * CELL_WIDTH + CELL_NUM_PADDING,
+				CELL_NUM_SCALE);
 		}
 	}
 }
 
 static void load_random_board(void)
 {
-	extern uint8_t
-	sudoku_boards[NUM_SUDOKU_BOARDS][SUDOKU_GRID_WH][SUDOKU_GRID_WH];
-	int i = randInt(0, NUM_SUDOKU_BOARDS - 1);
-	tiles_initial = (uint8_t *) sudoku_boards[i];
+#ifdef BENCH
+	// The bench scenario types in the solution of the first board.
+	int i = 0;
+#else
+	int i = rng_below(&rng_streams[RNG_SUDOKU], pack->n_boards);
+#endif
+	board_index = i;
+	tiles_initial = pack->boards[i];
 	memcpy(tiles, tiles_initial, sizeof tiles);
 }
 
 void sudoku_mainloop(void)
 {
-	load_random_board();
-	update_candidate_set();
+	if (!(bss = arena_alloc(&arena, sizeof *bss)))
+		return;
+	// A pack without boards would leave nothing to pick from.
+	if (!(pack = module_data(SUDOKU_DATA, NULL)) || pack->n_boards == 0)
+		return;
+	if (!(given_glyphs = glyphs_new(&arena, BLACK))
+		|| !(placed_glyphs = glyphs_new(&arena, RED)))
+		return;
+	if (!load_snapshot()) {
+		load_random_board();
+		update_candidate_set();
+	}
+	g_layer_begin(draw_grid, WHITE);
 
+	BENCH_MARK();
 	for (;;) {
 		draw();
-		gfx_SwapDraw();
+		g_swap();
+		BENCH_FRAME(BENCH_SUDOKU);
 
 		uint8_t key;
 		while (!(key = os_GetCSC()))
 			;
+		BENCH_MARK();
 
 		int num_to_insert = -1;
 
@@ -138,6 +218,7 @@ void sudoku_mainloop(void)
 				try_inc_coord(&curx);
 				break;
 			case sk_Clear:
+				save_snapshot();
 				return;
 			case sk_Del:
 				num_to_insert = 0;
@@ -177,6 +258,7 @@ void sudoku_mainloop(void)
 			change_candidate_set_at_cur(num_to_insert, false);
 
 			if (all(tiles, SUDOKU_GRID_WH * SUDOKU_GRID_WH, 1)) {
+				snapshot_discard(SUDOKU_SNAPSHOT);
 				const char *wonlines[] = {
 					"You",
 					"solved",
@@ -187,7 +269,7 @@ void sudoku_mainloop(void)
 
 				draw();
 				g_list(wonlines, 5, 85);
-				gfx_SwapDraw();
+				g_swap();
 
 				while (!os_GetCSC())
 					;
@@ -209,13 +291,13 @@ static bool validate_num_insert_at_cur(int n)
 		return true;
 
 
-	uint24_t box_y = cury / 3 * 3;
-	uint24_t box_x = curx / 3 * 3;
+	uint8_t box_y = box_start[cury];
+	uint8_t box_x = box_start[curx];
 
 	for (int i = 0; i < 9; ++i) {
 		if (tiles[i][curx] == n ||
 			tiles[cury][i] == n ||
-			tiles[box_y + i / 3][box_x + i % 3] == n)
+			tiles[box_y + box_dy[i]][box_x + box_dx[i]] == n)
 			return false;
 	}
 	return true;
@@ -240,9 +322,11 @@ static void update_candidate_set(void)
 	tempx = curx;
 	for (cury = 0; cury < SUDOKU_GRID_WH; ++cury) {
 		for (curx = 0; curx < SUDOKU_GRID_WH; ++curx) {
+			uint16_t set = 0;
 			for (int n = 0; n <= 9; ++n)
-				candidate_set[cury][curx][n] =
-					validate_num_insert_at_cur(n);
+				set |= (uint16_t) validate_num_insert_at_cur(n)
+					<< n;
+			candidate_set[cury][curx] = set;
 		}
 	}
 	cury = tempy;
@@ -253,11 +337,72 @@ static void change_candidate_set_at_cur(int n, bool presence)
 {
 	if (n == 0)
 		return;
-	uint24_t box_y = cury / 3 * 3;
-	uint24_t box_x = curx / 3 * 3;
+	uint8_t box_y = box_start[cury];
+	uint8_t box_x = box_start[curx];
+	uint16_t bit = 1 << n;
+	uint16_t set = presence ? bit : 0;
 	for (int i = 0; i < SUDOKU_GRID_WH; ++i) {
-		candidate_set[i][curx][n] = presence;
-		candidate_set[cury][i][n] = presence;
-		candidate_set[box_y + i / 3][box_x + i % 3][n] = presence;
+		uint16_t *col = &candidate_set[i][curx];
+		uint16_t *row = &candidate_set[cury][i];
+		uint16_t *box =
+			&candidate_set[box_y + box_dy[i]][box_x + box_dx[i]];
+		*col = (*col & ~bit) | set;
+		*row = (*row & ~bit) | set;
+		*box = (*box & ~bit) | set;
+	}
+}
+
+static void save_snapshot(void)
+{
+	struct Snapshot snap;
+	const uint8_t *tiles_1d = (const uint8_t *) tiles;
+	const uint16_t *candidates_1d = (const uint16_t *) candidate_set;
+
+	memset(&snap, 0, sizeof snap);
+	snap.board = board_index;
+	snap.cursor_x = curx;
+	snap.cursor_y = cury;
+	for (int i = 0; i < N_CELLS; ++i) {
+		snap.digits[i / 2] |= tiles_1d[i] << (i % 2 * 4);
+		for (int n = 1; n <= 9; ++n) {
+			if (candidates_1d[i] >> n & 1)
+				BITS_SET(snap.candidates, i * 9 + n - 1);
+		}
 	}
-}
\ No newline at end of file
+	snapshot_save(SUDOKU_SNAPSHOT, &snap, sizeof snap);
+}
+
+/* Returns false if there is no game to resume, or if the saved one has a
+ * cursor off the grid or a digit that isn't one.
+ */
+static bool load_snapshot(void)
+{
+	struct Snapshot snap;
+	uint8_t *tiles_1d = (uint8_t *) tiles;
+	uint16_t *candidates_1d = (uint16_t *) candidate_set;
+
+	if (snapshot_load(SUDOKU_SNAPSHOT, &snap, sizeof snap) != sizeof snap
+		|| snap.board >= pack->n_boards
+		|| snap.cursor_x >= SUDOKU_GRID_WH
+		|| snap.cursor_y >= SUDOKU_GRID_WH)
+		return false;
+	for (int i = 0; i < N_CELLS; ++i) {
+		if ((snap.digits[i / 2] >> (i % 2 * 4) & 0xf) > 9)
+			return false;
+	}
+
+	board_index = snap.board;
+	tiles_initial = pack->boards[board_index];
+	curx = snap.cursor_x;
+	cury = snap.cursor_y;
+	for (int i = 0; i < N_CELLS; ++i) {
+		tiles_1d[i] = snap.digits[i / 2] >> (i % 2 * 4) & 0xf;
+		// 0 (erasing) is allowed wherever the board left a blank.
+		uint16_t set = tiles_initial[i] == 0;
+		for (int n = 1; n <= 9; ++n)
+			set |= (uint16_t) BITS_GET(snap.candidates, i * 9 + n - 1)
+				<< n;
+		candidates_1d[i] = set;
+	}
+	return true;
+}
@@ -0,0 +1,26 @@
+#!/usr/bin/env python3
+
+"""
+Pack the Sudoku boards in sudoku_boards.txt into the MASUDDAT AppVar
+(data/MASUDDAT.bin). Every line is one board of 81 digits, row by row, with
+0 for a blank cell.
+"""
+
+import os
+
+base_path = os.path.dirname(__file__)
+
+boards = []
+with open(os.path.join(base_path, "sudoku_boards.txt")) as f:
+    for line in f:
+        line = line.strip()
+        if not line:
+            continue
+        assert len(line) == 81 and line.isdigit(), f"bad board: {line}"
+        boards.append(bytes(int(c) for c in line))
+
+assert 0 < len(boards) < 256, "the board count must fit a byte"
+
+# The layout is struct SudokuData in sudoku_app.c.
+with open(os.path.join(base_path, "..", "data", "MASUDDAT.bin"), "wb") as f:
+    f.write(bytes([len(boards)]) + b"".join(boards))
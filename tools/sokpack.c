@@ -0,0 +1,1080 @@
+/* sokpack: compiles Sokoban levels in the XSB text format into a level pack
+ * (see src/levelpack.h).
+ *
+ *     sokpack [-v] [-s] [-c CODEC,...] [-o PREFIX] FILE...
+ *
+ * The index is written to PREFIX"DAT.bin" and the volumes to PREFIX"V00.bin",
+ * PREFIX"V01.bin" and so on, PREFIX being data/MASOK by default. Every level
+ * is
+ *  - validated: one player, as many boxes as goals and enclosed by walls,
+ *  - normalised: blank rows and columns around it are dropped, and a level
+ *    that only fits the game on its side is turned,
+ *  - deduplicated: a level that is another one rotated or mirrored, with the
+ *    player anywhere in the same area, is dropped,
+ *  - encoded with whichever codec makes it smallest, of those -c names
+ *    (all of them by default) and raw.
+ * Invalid levels are reported and fail the run. -v reports every level and
+ * -s how large the pack would be with each codec alone, to weigh the size
+ * against how fast the codecs decode (see bench/host).
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
+#include <limits.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+
+#include "../src/levelpack.h"
+
+#define MAX_CELLS (LEVEL_MAX_W * LEVEL_MAX_H)
+#define BLOCK_HEADER_SIZE 5
+
+// Marks the cells of the key the player can walk to.
+#define PLAYER_AREA_BIT 0x10
+
+struct Level {
+	const char *file;
+	int line;
+	int w, h;
+	int px, py;
+	uint8_t cells[MAX_CELLS];
+	// The smallest of the level's 8 orientations, for finding duplicates.
+	uint8_t key[2 + MAX_CELLS];
+	size_t key_size;
+	uint64_t hash;
+	uint8_t block[BLOCK_HEADER_SIZE + 2 * MAX_CELLS];
+	size_t block_size;
+};
+
+static struct Level *levels;
+static size_t n_levels, levels_cap;
+static bool verbose, stats;
+// The codecs -c allows, by enum LevelCodec.
+static unsigned allowed = ~0u;
+static int n_errors;
+
+static void *xrealloc(void *p, size_t size)
+{
+	if (!(p = realloc(p, size))) {
+		perror("sokpack");
+		exit(1);
+	}
+	return p;
+}
+
+static void error(const struct Level *l, const char *msg)
+{
+	fprintf(stderr, "%s:%d: %s\n", l->file, l->line, msg);
+	++n_errors;
+}
+
+/* zx7, the format of the toolchain's zx7_Decompress(). The parse is optimal:
+ * for every position, the cheapest way to end there is a literal or a match
+ * of any length up to the longest one ending there, with a one byte offset
+ * or a long one.
+ */
+#define ZX7_MAX_OFFSET 2176
+
+struct BitWriter {
+	uint8_t *out;
+	size_t n;
+	size_t bits_at;
+	uint8_t mask;
+};
+
+static void write_byte(struct BitWriter *w, uint8_t b)
+{
+	w->out[w->n++] = b;
+}
+
+static void write_bit(struct BitWriter *w, int bit)
+{
+	if (!w->mask) {
+		w->mask = 0x80;
+		w->bits_at = w->n;
+		write_byte(w, 0);
+	}
+	if (bit)
+		w->out[w->bits_at] |= w->mask;
+	w->mask >>= 1;
+}
+
+static void write_gamma(struct BitWriter *w, unsigned v)
+{
+	unsigned i;
+	for (i = 2; i <= v; i <<= 1)
+		write_bit(w, 0);
+	while ((i >>= 1) > 0)
+		write_bit(w, v & i);
+}
+
+static unsigned gamma_bits(unsigned v)
+{
+	unsigned bits = 1;
+	for (; v > 1; v >>= 1)
+		bits += 2;
+	return bits;
+}
+
+static size_t zx7_compress(const uint8_t *in, size_t n, uint8_t *out)
+{
+	unsigned long *cost = xrealloc(NULL, (n + 1) * sizeof *cost);
+	unsigned *len = xrealloc(NULL, (n + 1) * sizeof *len);
+	unsigned *off = xrealloc(NULL, (n + 1) * sizeof *off);
+	// The length of the match with offset o that ends at the position.
+	unsigned *run = calloc(ZX7_MAX_OFFSET + 1, sizeof *run);
+
+	cost[1] = 8;
+	len[1] = 1;
+	for (size_t j = 2; j <= n; ++j) {
+		unsigned best[2] = { 0, 0 }, best_off[2] = { 0, 0 };
+
+		for (unsigned o = 1; o <= ZX7_MAX_OFFSET && o < j; ++o) {
+			run[o] = (in[j - 1] == in[j - 1 - o]) ? run[o] + 1 : 0;
+			int far = o > 128;
+			if (run[o] > best[far]) {
+				best[far] = run[o];
+				best_off[far] = o;
+			}
+		}
+
+		cost[j] = cost[j - 1] + 9;
+		len[j] = 1;
+		for (int far = 0; far < 2; ++far) {
+			for (unsigned l = 2; l <= best[far] && l < j; ++l) {
+				unsigned long c = cost[j - l] + 9 + 4 * far
+					+ gamma_bits(l - 1);
+				if (c < cost[j]) {
+					cost[j] = c;
+					len[j] = l;
+					off[j] = best_off[far];
+				}
+			}
+		}
+	}
+
+	// Walks back the parse to write it out from the start.
+	unsigned *steps = xrealloc(NULL, (n + 1) * sizeof *steps);
+	size_t n_steps = 0;
+	for (size_t p = n; p > 1; p -= len[p])
+		steps[n_steps++] = p;
+
+	struct BitWriter w = { out, 0, 0, 0 };
+	write_byte(&w, in[0]);
+	while (n_steps--) {
+		size_t p = steps[n_steps];
+		if (len[p] == 1) {
+			write_bit(&w, 0);
+			write_byte(&w, in[p - 1]);
+			continue;
+		}
+		write_bit(&w, 1);
+		write_gamma(&w, len[p] - 1);
+		unsigned o = off[p] - 1;
+		if (o < 128) {
+			write_byte(&w, o);
+		} else {
+			o -= 128;
+			write_byte(&w, (o & 127) | 128);
+			for (unsigned m = 1024; m > 127; m >>= 1)
+				write_bit(&w, o & m);
+		}
+	}
+	write_bit(&w, 1);
+	for (int i = 0; i < 16; ++i)
+		write_bit(&w, 0);
+	write_bit(&w, 1);
+
+	free(cost);
+	free(len);
+	free(off);
+	free(run);
+	free(steps);
+	return w.n;
+}
+
+struct BitReader {
+	const uint8_t *in;
+	uint8_t value, mask;
+};
+
+static int read_bit(struct BitReader *r)
+{
+	r->mask >>= 1;
+	if (!r->mask) {
+		r->mask = 0x80;
+		r->value = *r->in++;
+	}
+	return (r->value & r->mask) != 0;
+}
+
+// Returns the size of the output, which is at most max, or 0 if it isn't.
+static size_t zx7_decompress(const uint8_t *in, uint8_t *out, size_t max)
+{
+	struct BitReader r = { in, 0, 0 };
+	size_t n = 0;
+
+	out[n++] = *r.in++;
+	for (;;) {
+		if (!read_bit(&r)) {
+			if (n == max)
+				return 0;
+			out[n++] = *r.in++;
+			continue;
+		}
+		int bits = 0;
+		while (!read_bit(&r))
+			++bits;
+		if (bits > 15)
+			return n;
+		unsigned length = 1;
+		while (bits--)
+			length = length << 1 | read_bit(&r);
+		++length;
+		unsigned offset = *r.in++;
+		if (offset & 0x80) {
+			unsigned high = 0;
+			for (int i = 0; i < 4; ++i)
+				high = high << 1 | read_bit(&r);
+			offset = ((offset & 0x7f) | high << 7) + 0x80;
+		}
+		++offset;
+		if (offset > n || n + length > max)
+			return 0;
+		for (; length; --length, ++n)
+			out[n] = out[n - offset];
+	}
+}
+
+/* zx0, the format of the toolchain's zx0_Decompress(): blocks of literals
+ * and matches, a match after literals being able to reuse the last offset
+ * for free. As that makes the cost of a match depend on the path taken to it,
+ * the parse keeps the cheapest way to end at every position with literals
+ * and with a match, each with its last offset, which comes close to optimal.
+ */
+#define ZX0_END 256
+
+struct Zx0Writer {
+	struct BitWriter w;
+	/* The next bit goes in the low bit of the last byte, the byte of an
+	 * offset, which the decoder takes as the first bit of the length.
+	 */
+	bool backtrack;
+};
+
+static void zx0_write_bit(struct Zx0Writer *z, int bit)
+{
+	if (z->backtrack) {
+		if (bit)
+			z->w.out[z->w.n - 1] |= 1;
+		z->backtrack = false;
+	} else {
+		write_bit(&z->w, bit);
+	}
+}
+
+// Elias gamma with every bit of the value after a 0, then a 1.
+static void zx0_write_gamma(struct Zx0Writer *z, unsigned v, int invert)
+{
+	unsigned i;
+	for (i = 2; i <= v; i <<= 1)
+		;
+	for (i >>= 1; i >>= 1;) {
+		zx0_write_bit(z, 0);
+		zx0_write_bit(z, !!(v & i) ^ invert);
+	}
+	zx0_write_bit(z, 1);
+}
+
+enum { ZX0_LITERALS, ZX0_MATCH };
+
+struct Zx0Step {
+	unsigned long cost;
+	// Where the block that ends here starts, and in which state.
+	unsigned from;
+	uint8_t from_state;
+	// The offset in effect after it, and whether it is a new one.
+	unsigned offset;
+	bool new_offset;
+};
+
+static unsigned long zx0_new_offset_bits(unsigned offset, unsigned len)
+{
+	return 1 + gamma_bits((offset - 1) / 128 + 1) + 7 + gamma_bits(len - 1);
+}
+
+static size_t zx0_compress(const uint8_t *in, size_t n, uint8_t *out)
+{
+	struct Zx0Step (*best)[2] = xrealloc(NULL, (n + 1) * sizeof *best);
+	unsigned *run = calloc(n + 1, sizeof *run);
+	unsigned *shortest = xrealloc(NULL, (n + 1) * sizeof *shortest);
+
+	for (size_t j = 0; j <= n; ++j)
+		best[j][ZX0_LITERALS].cost = best[j][ZX0_MATCH].cost = ULONG_MAX;
+	// The data starts with literals, as if after a match with offset 1.
+	best[0][ZX0_MATCH] = (struct Zx0Step) { 0, 0, 0, 1, false };
+
+	for (size_t j = 1; j <= n; ++j) {
+		struct Zx0Step *lit = &best[j][ZX0_LITERALS];
+		struct Zx0Step *match = &best[j][ZX0_MATCH];
+
+		for (size_t i = 0; i < j; ++i) {
+			if (best[i][ZX0_MATCH].cost == ULONG_MAX)
+				continue;
+			unsigned long c = best[i][ZX0_MATCH].cost + (i > 0)
+				+ gamma_bits(j - i) + 8 * (j - i);
+			if (c < lit->cost) {
+				*lit = (struct Zx0Step) { c, i, ZX0_MATCH,
+					best[i][ZX0_MATCH].offset, false };
+			}
+		}
+
+		/* run[o] is the length of the match with offset o ending here,
+		 * and shortest[l] the smallest offset with a match of l.
+		 */
+		unsigned longest = 0;
+		for (unsigned o = 1; o < j; ++o) {
+			run[o] = (in[j - 1] == in[j - 1 - o]) ? run[o] + 1 : 0;
+			for (; longest < run[o]; ++longest)
+				shortest[longest + 1] = o;
+		}
+		for (unsigned l = 1; l <= longest; ++l) {
+			const struct Zx0Step *prev = &best[j - l][ZX0_LITERALS];
+			if (prev->cost != ULONG_MAX && run[prev->offset] >= l) {
+				unsigned long c = prev->cost + 1 + gamma_bits(l);
+				if (c < match->cost) {
+					*match = (struct Zx0Step) { c, j - l,
+						ZX0_LITERALS, prev->offset,
+						false };
+				}
+			}
+			if (l < 2)
+				continue;
+			for (int s = 0; s < 2; ++s) {
+				prev = &best[j - l][s];
+				if (prev->cost == ULONG_MAX)
+					continue;
+				unsigned long c = prev->cost
+					+ zx0_new_offset_bits(shortest[l], l);
+				if (c < match->cost) {
+					*match = (struct Zx0Step) { c, j - l, s,
+						shortest[l], true };
+				}
+			}
+		}
+	}
+
+	// Walks back the parse to write it out from the start.
+	size_t (*steps)[2] = xrealloc(NULL, (n + 1) * sizeof *steps);
+	size_t n_steps = 0;
+	int state = best[n][ZX0_MATCH].cost < best[n][ZX0_LITERALS].cost ?
+		ZX0_MATCH : ZX0_LITERALS;
+	for (size_t p = n; p > 0;) {
+		steps[n_steps][0] = p;
+		steps[n_steps++][1] = state;
+		int from_state = best[p][state].from_state;
+		p = best[p][state].from;
+		state = from_state;
+	}
+
+	struct Zx0Writer z = { { out, 0, 0, 0 }, false };
+	size_t at = 0;
+	while (n_steps--) {
+		size_t p = steps[n_steps][0];
+		const struct Zx0Step *step = &best[p][steps[n_steps][1]];
+		if (steps[n_steps][1] == ZX0_LITERALS) {
+			if (at)
+				zx0_write_bit(&z, 0);
+			zx0_write_gamma(&z, p - at, 0);
+			for (; at < p; ++at)
+				write_byte(&z.w, in[at]);
+		} else if (!step->new_offset) {
+			zx0_write_bit(&z, 0);
+			zx0_write_gamma(&z, p - at, 0);
+		} else {
+			zx0_write_bit(&z, 1);
+			zx0_write_gamma(&z, (step->offset - 1) / 128 + 1, 1);
+			write_byte(&z.w, (127 - (step->offset - 1) % 128) << 1);
+			z.backtrack = true;
+			zx0_write_gamma(&z, p - at - 1, 0);
+		}
+		at = p;
+	}
+	zx0_write_bit(&z, 1);
+	zx0_write_gamma(&z, ZX0_END, 1);
+
+	free(best);
+	free(run);
+	free(shortest);
+	free(steps);
+	return z.w.n;
+}
+
+static unsigned zx0_read_gamma(struct BitReader *r, const uint8_t **backtrack,
+	int invert)
+{
+	unsigned value = 1;
+
+	for (;;) {
+		int bit;
+		if (*backtrack) {
+			bit = **backtrack & 1;
+			*backtrack = NULL;
+		} else {
+			bit = read_bit(r);
+		}
+		if (bit || value > 0xffff)
+			return value;
+		value = value << 1 | (read_bit(r) ^ invert);
+	}
+}
+
+// Returns the size of the output, which is at most max, or 0 if it isn't.
+static size_t zx0_decompress(const uint8_t *in, uint8_t *out, size_t max)
+{
+	struct BitReader r = { in, 0, 0 };
+	const uint8_t *backtrack = NULL;
+	unsigned offset = 1, len;
+	size_t n = 0;
+	bool literals = true;
+
+	for (;;) {
+		if (literals) {
+			len = zx0_read_gamma(&r, &backtrack, 0);
+			if (n + len > max)
+				return 0;
+			memcpy(&out[n], r.in, len);
+			r.in += len;
+			n += len;
+		} else {
+			len = zx0_read_gamma(&r, &backtrack, 0);
+			if (offset > n || n + len > max)
+				return 0;
+			for (; len; --len, ++n)
+				out[n] = out[n - offset];
+		}
+		// After literals, 0 reuses the offset, after a match it is
+		// literals again, and 1 is a new offset either way.
+		while (read_bit(&r)) {
+			offset = zx0_read_gamma(&r, &backtrack, 1);
+			if (offset == ZX0_END)
+				return n;
+			offset = offset * 128 - (*r.in >> 1);
+			backtrack = r.in++;
+			len = zx0_read_gamma(&r, &backtrack, 0) + 1;
+			if (offset > n || n + len > max)
+				return 0;
+			for (; len; --len, ++n)
+				out[n] = out[n - offset];
+			literals = false;
+		}
+		literals = !literals;
+	}
+}
+
+/* LZ4's block format, as levelpack.c decodes it: the last sequence has
+ * literals only, and the decoder stops once it has all the cells instead of
+ * at the end of the data. Matches are at least 4 long and found greedily.
+ */
+#define LZ4_MIN_MATCH 4
+
+static void lz4_write_length(uint8_t *out, size_t *n, size_t len)
+{
+	if (len < 15)
+		return;
+	for (len -= 15; len >= 255; len -= 255)
+		out[(*n)++] = 255;
+	out[(*n)++] = len;
+}
+
+static size_t lz4_compress(const uint8_t *in, size_t n, uint8_t *out)
+{
+	size_t size = 0, literals = 0, i = 0;
+
+	for (;;) {
+		size_t best = 0, best_off = 0;
+		for (size_t o = 1; i < n && o <= i && o <= 0xffff; ++o) {
+			size_t l = 0;
+			while (i + l < n && in[i + l] == in[i + l - o])
+				++l;
+			if (l > best) {
+				best = l;
+				best_off = o;
+			}
+		}
+		if (i < n && best < LZ4_MIN_MATCH) {
+			++i;
+			continue;
+		}
+
+		size_t lit = i - literals;
+		size_t match = (i < n) ? best - LZ4_MIN_MATCH : 0;
+		out[size++] = (lit < 15 ? lit : 15) << 4
+			| (match < 15 ? match : 15);
+		lz4_write_length(out, &size, lit);
+		memcpy(&out[size], &in[literals], lit);
+		size += lit;
+		if (i == n)
+			return size;
+		out[size++] = best_off;
+		out[size++] = best_off >> 8;
+		lz4_write_length(out, &size, match);
+		i += best;
+		literals = i;
+	}
+}
+
+static size_t lz4_read_length(const uint8_t **in, size_t len)
+{
+	if (len == 15) {
+		uint8_t more;
+		do {
+			more = *(*in)++;
+			len += more;
+		} while (more == 255);
+	}
+	return len;
+}
+
+static size_t lz4_decode(const uint8_t *in, uint8_t *out, size_t n)
+{
+	size_t at = 0;
+
+	for (;;) {
+		uint8_t token = *in++;
+		size_t len = lz4_read_length(&in, token >> 4);
+		if (at + len > n)
+			return 0;
+		memcpy(&out[at], in, len);
+		in += len;
+		at += len;
+		if (at == n)
+			return n;
+
+		size_t offset = in[0] | in[1] << 8;
+		in += 2;
+		len = lz4_read_length(&in, token & 0xf) + LZ4_MIN_MATCH;
+		if (!offset || offset > at || at + len > n)
+			return 0;
+		for (; len; --len, ++at)
+			out[at] = out[at - offset];
+	}
+}
+
+// Nibble RLE, see enum LevelCodec.
+static size_t rle_encode(const uint8_t *cells, size_t n, uint8_t *out)
+{
+	size_t size = 0;
+
+	for (size_t i = 0; i < n;) {
+		size_t run = 1;
+		if (cells[i] > 0xf)
+			return 0;
+		while (run < 16 && i + run < n && cells[i + run] == cells[i])
+			++run;
+		out[size++] = (run - 1) << 4 | cells[i];
+		i += run;
+	}
+	return size;
+}
+
+static size_t rle_decode(const uint8_t *in, uint8_t *out, size_t n)
+{
+	size_t at = 0;
+
+	while (at < n) {
+		size_t run = (*in >> 4) + 1;
+		if (at + run > n)
+			return 0;
+		memset(&out[at], *in++ & 0xf, run);
+		at += run;
+	}
+	return n;
+}
+
+/* The codecs, by enum LevelCodec. An encoder returns the size of the data or
+ * 0 if it can't encode the cells, and a decoder is how the result is
+ * checked.
+ */
+static size_t raw_encode(const uint8_t *cells, size_t n, uint8_t *out)
+{
+	memcpy(out, cells, n);
+	return n;
+}
+
+static size_t raw_decode(const uint8_t *in, uint8_t *out, size_t n)
+{
+	memcpy(out, in, n);
+	return n;
+}
+
+static size_t zx7_decode(const uint8_t *in, uint8_t *out, size_t n)
+{
+	return zx7_decompress(in, out, n);
+}
+
+static size_t zx0_decode(const uint8_t *in, uint8_t *out, size_t n)
+{
+	return zx0_decompress(in, out, n);
+}
+
+static const struct {
+	const char *name;
+	size_t (*encode)(const uint8_t *cells, size_t n, uint8_t *out);
+	size_t (*decode)(const uint8_t *in, uint8_t *out, size_t n);
+} codecs[] = {
+	[LEVEL_CODEC_RAW] = { "raw", raw_encode, raw_decode },
+	[LEVEL_CODEC_ZX7] = { "zx7", zx7_compress, zx7_decode },
+	[LEVEL_CODEC_ZX0] = { "zx0", zx0_compress, zx0_decode },
+	[LEVEL_CODEC_LZ4] = { "lz4", lz4_compress, lz4_decode },
+	[LEVEL_CODEC_RLE] = { "rle", rle_encode, rle_decode },
+};
+
+#define N_CODECS (sizeof codecs / sizeof codecs[0])
+
+// The size of every level with each codec alone, for -s.
+static size_t codec_total[N_CODECS];
+
+/* Encodes the level with every codec, whether allowed or not, so that -s
+ * can tell what each would come to, and keeps the smallest allowed.
+ */
+static void encode(struct Level *l)
+{
+	size_t n = l->w * l->h;
+	uint8_t data[2 * MAX_CELLS + 16], check[MAX_CELLS];
+
+	l->block_size = 0;
+	for (size_t c = 0; c < N_CODECS; ++c) {
+		size_t size = codecs[c].encode(l->cells, n, data);
+		codec_total[c] += BLOCK_HEADER_SIZE + (size ? size : n);
+		if (!size || !(allowed >> c & 1) || (l->block_size
+			&& BLOCK_HEADER_SIZE + size >= l->block_size))
+			continue;
+		if (codecs[c].decode(data, check, n) != n
+			|| memcmp(check, l->cells, n)) {
+			fprintf(stderr, "sokpack: %s fails on %s:%d\n",
+				codecs[c].name, l->file, l->line);
+			exit(1);
+		}
+		l->block[0] = c;
+		l->block[1] = l->w;
+		l->block[2] = l->h;
+		l->block[3] = l->px;
+		l->block[4] = l->py;
+		memcpy(&l->block[BLOCK_HEADER_SIZE], data, size);
+		l->block_size = BLOCK_HEADER_SIZE + size;
+	}
+	if (verbose) {
+		printf("%s:%d: %dx%d, %zu bytes %s\n", l->file, l->line,
+			l->w, l->h, l->block_size, codecs[l->block[0]].name);
+	}
+}
+
+/* Marks in area the cells the player can walk to without going through the
+ * cells with any of the flags in blocked. Returns false if that gets to the
+ * edge, as the level isn't enclosed.
+ */
+static bool walk(const struct Level *l, uint8_t blocked, bool *area)
+{
+	int stack[MAX_CELLS], top = 0;
+
+	memset(area, 0, l->w * l->h * sizeof *area);
+	stack[top++] = l->py * l->w + l->px;
+	area[stack[0]] = true;
+	while (top) {
+		int i = stack[--top], x = i % l->w, y = i / l->w;
+		if (x == 0 || y == 0 || x == l->w - 1 || y == l->h - 1)
+			return false;
+		const int next[4] = { i - 1, i + 1, i - l->w, i + l->w };
+		for (int d = 0; d < 4; ++d) {
+			if (area[next[d]] || l->cells[next[d]] & blocked)
+				continue;
+			area[next[d]] = true;
+			stack[top++] = next[d];
+		}
+	}
+	return true;
+}
+
+/* The key is the smallest of the 8 ways to turn and mirror the level, with
+ * the area the player can walk in instead of where the player is. Boxes
+ * bound the area, as the side of a box the player is on matters.
+ */
+static void make_key(struct Level *l, const bool *area)
+{
+	uint8_t key[2 + MAX_CELLS];
+
+	l->key_size = 0;
+	for (int t = 0; t < 8; ++t) {
+		bool transpose = t & 4, flip_x = t & 2, flip_y = t & 1;
+		int w = transpose ? l->h : l->w, h = transpose ? l->w : l->h;
+
+		key[0] = w;
+		key[1] = h;
+		for (int y = 0; y < h; ++y) {
+			for (int x = 0; x < w; ++x) {
+				int sx = flip_x ? w - 1 - x : x;
+				int sy = flip_y ? h - 1 - y : y;
+				int i = transpose ? sx * l->w + sy
+					: sy * l->w + sx;
+				key[2 + y * w + x] = l->cells[i]
+					| (area[i] ? PLAYER_AREA_BIT : 0);
+			}
+		}
+		size_t size = 2 + w * h;
+		if (!l->key_size || memcmp(key, l->key, size) < 0) {
+			memcpy(l->key, key, size);
+			l->key_size = size;
+		}
+	}
+
+	// FNV-1a
+	l->hash = 14695981039346656037ull;
+	for (size_t i = 0; i < l->key_size; ++i)
+		l->hash = (l->hash ^ l->key[i]) * 1099511628211ull;
+}
+
+/* Turns the rows into the level's cells. Returns false after reporting why
+ * if the level is invalid. Blank columns and rows around the level are
+ * dropped, and it is turned if it only fits that way.
+ */
+static bool compile(struct Level *l, char **rows, int n_rows)
+{
+	int x0 = 1 << 30, x1 = 0, y0 = -1, y1 = 0;
+	int n_players = 0, n_boxes = 0, n_goals = 0;
+
+	for (int y = 0; y < n_rows; ++y) {
+		int len = strlen(rows[y]);
+		for (int x = 0; x < len; ++x) {
+			if (strchr(" -_", rows[y][x]))
+				continue;
+			if (x < x0)
+				x0 = x;
+			if (x + 1 > x1)
+				x1 = x + 1;
+			if (y0 < 0)
+				y0 = y;
+			y1 = y + 1;
+		}
+	}
+
+	int w = x1 - x0, h = y1 - y0;
+	bool turn = (w > LEVEL_MAX_W || h > LEVEL_MAX_H)
+		&& h <= LEVEL_MAX_W && w <= LEVEL_MAX_H;
+	if (!turn && (w > LEVEL_MAX_W || h > LEVEL_MAX_H)) {
+		error(l, "too large");
+		return false;
+	}
+	l->w = turn ? h : w;
+	l->h = turn ? w : h;
+
+	for (int y = 0; y < h; ++y) {
+		const char *row = rows[y0 + y];
+		int len = strlen(row);
+		for (int x = 0; x < w; ++x) {
+			char c = (x0 + x < len) ? row[x0 + x] : ' ';
+			int cx = turn ? y : x, cy = turn ? x : y;
+			uint8_t cell = 0;
+
+			switch (c) {
+			case '#':
+				cell = WALL_BIT;
+				break;
+			case '$':
+				cell = BOX_BIT;
+				break;
+			case '*':
+				cell = BOX_BIT | GOAL_BIT;
+				break;
+			case '+':
+				cell = GOAL_BIT;
+				// fall through
+			case '@':
+				++n_players;
+				l->px = cx;
+				l->py = cy;
+				break;
+			case '.':
+				cell = GOAL_BIT;
+				break;
+			}
+			n_boxes += !!(cell & BOX_BIT);
+			n_goals += !!(cell & GOAL_BIT);
+			l->cells[cy * l->w + cx] = cell;
+		}
+	}
+
+	bool area[MAX_CELLS];
+	if (n_players != 1)
+		error(l, n_players ? "more than one player" : "no player");
+	else if (n_boxes == 0)
+		error(l, "no boxes");
+	else if (n_boxes != n_goals)
+		error(l, "not as many boxes as goals");
+	// Boxes may be pushed out of the way, so only walls enclose a level.
+	else if (!walk(l, WALL_BIT, area))
+		error(l, "not enclosed by walls");
+	else {
+		walk(l, WALL_BIT | BOX_BIT, area);
+		make_key(l, area);
+		return true;
+	}
+	return false;
+}
+
+/* A row of a level only has these and at least one wall. Anything else,
+ * such as titles and comments, ends the level.
+ */
+static bool is_row(const char *line)
+{
+	if (!strchr(line, '#'))
+		return false;
+	return line[strspn(line, "#@+$*. -_")] == '\0';
+}
+
+static void add_level(const char *file, int line, char **rows, int n_rows)
+{
+	if (n_levels == levels_cap) {
+		levels_cap = levels_cap ? 2 * levels_cap : 256;
+		levels = xrealloc(levels, levels_cap * sizeof *levels);
+	}
+	struct Level *l = &levels[n_levels];
+	l->file = file;
+	l->line = line;
+	if (compile(l, rows, n_rows))
+		++n_levels;
+}
+
+static void read_levels(const char *file)
+{
+	FILE *f = fopen(file, "r");
+	if (!f) {
+		fprintf(stderr, "sokpack: %s: %s\n", file, strerror(errno));
+		exit(1);
+	}
+
+	char *line = NULL;
+	size_t line_cap = 0;
+	char **rows = NULL;
+	int n_rows = 0, rows_cap = 0, line_no = 0, first = 0;
+	ssize_t len;
+
+	do {
+		len = getline(&line, &line_cap, f);
+		++line_no;
+		if (len > 0) {
+			line[strcspn(line, "\r\n")] = '\0';
+			if (is_row(line)) {
+				if (n_rows == rows_cap) {
+					rows_cap = rows_cap ? 2 * rows_cap : 16;
+					rows = xrealloc(rows,
+						rows_cap * sizeof *rows);
+				}
+				if (!n_rows)
+					first = line_no;
+				rows[n_rows++] = strdup(line);
+				continue;
+			}
+		}
+		if (n_rows) {
+			add_level(file, first, rows, n_rows);
+			while (n_rows)
+				free(rows[--n_rows]);
+		}
+	} while (len > 0);
+
+	free(rows);
+	free(line);
+	fclose(f);
+}
+
+/* Drops the levels whose key is already taken, keeping the first. */
+static size_t dedup(void)
+{
+	size_t cap = 1;
+	while (cap < 2 * n_levels)
+		cap <<= 1;
+	const struct Level **table = calloc(cap, sizeof *table);
+	size_t kept = 0;
+
+	for (size_t i = 0; i < n_levels; ++i) {
+		struct Level *l = &levels[i];
+		size_t slot = l->hash & (cap - 1);
+		const struct Level *dup = NULL;
+
+		for (; table[slot]; slot = (slot + 1) & (cap - 1)) {
+			const struct Level *t = table[slot];
+			if (t->hash == l->hash && t->key_size == l->key_size
+				&& !memcmp(t->key, l->key, l->key_size)) {
+				dup = t;
+				break;
+			}
+		}
+		if (dup) {
+			fprintf(stderr, "%s:%d: same as %s:%d, dropped\n",
+				l->file, l->line, dup->file, dup->line);
+			continue;
+		}
+		if (kept != i)
+			levels[kept] = *l;
+		table[slot] = &levels[kept++];
+	}
+	free(table);
+	size_t n_dups = n_levels - kept;
+	n_levels = kept;
+	return n_dups;
+}
+
+static FILE *create(const char *prefix, const char *suffix)
+{
+	char path[4096];
+	snprintf(path, sizeof path, "%s%s.bin", prefix, suffix);
+	FILE *f = fopen(path, "wb");
+	if (!f) {
+		fprintf(stderr, "sokpack: %s: %s\n", path, strerror(errno));
+		exit(1);
+	}
+	return f;
+}
+
+static void put32(uint8_t *p, uint32_t v)
+{
+	for (int i = 0; i < 4; ++i)
+		p[i] = v >> (8 * i);
+}
+
+// Returns the number of volumes written.
+static int write_pack(const char *prefix)
+{
+	size_t index_size = 4 + 4 * n_levels;
+	uint8_t *index = xrealloc(NULL, index_size);
+	int volume = 0;
+	size_t volume_size = 0;
+	char suffix[16];
+
+	snprintf(suffix, sizeof suffix, "V%02d", volume);
+	FILE *f = create(prefix, suffix);
+	for (size_t i = 0; i < n_levels; ++i) {
+		const struct Level *l = &levels[i];
+		if (volume_size + l->block_size > LEVELPACK_MAX_SIZE) {
+			fclose(f);
+			if (++volume == LEVELPACK_MAX_VOLUMES) {
+				fprintf(stderr, "sokpack: too many levels\n");
+				exit(1);
+			}
+			snprintf(suffix, sizeof suffix, "V%02d", volume);
+			f = create(prefix, suffix);
+			volume_size = 0;
+		}
+		put32(&index[4 + 4 * i], (uint32_t) volume << 16 | volume_size);
+		fwrite(l->block, 1, l->block_size, f);
+		volume_size += l->block_size;
+	}
+	fclose(f);
+
+	// Volumes left from a bigger pack would be sent along with this one.
+	for (int v = volume + 1; v < LEVELPACK_MAX_VOLUMES; ++v) {
+		char path[4096];
+		snprintf(path, sizeof path, "%sV%02d.bin", prefix, v);
+		if (remove(path))
+			break;
+	}
+
+	index[0] = LEVELPACK_VERSION;
+	index[1] = volume + 1;
+	index[2] = n_levels;
+	index[3] = n_levels >> 8;
+	f = create(prefix, "DAT");
+	fwrite(index, 1, index_size, f);
+	fclose(f);
+	free(index);
+	return volume + 1;
+}
+
+/* Parses the list of -c. raw is always allowed, as every level can be
+ * stored that way. Returns false if a name isn't a codec.
+ */
+static bool parse_codecs(char *list)
+{
+	allowed = 1 << LEVEL_CODEC_RAW;
+	for (char *name = strtok(list, ","); name; name = strtok(NULL, ",")) {
+		size_t c = 0;
+		while (c < N_CODECS && strcmp(name, codecs[c].name))
+			++c;
+		if (c == N_CODECS) {
+			fprintf(stderr, "sokpack: no codec %s\n", name);
+			return false;
+		}
+		allowed |= 1 << c;
+	}
+	return true;
+}
+
+int main(int argc, char *argv[])
+{
+	const char *prefix = "data/MASOK";
+	int i;
+
+	for (i = 1; i < argc && argv[i][0] == '-'; ++i) {
+		if (!strcmp(argv[i], "-v"))
+			verbose = true;
+		else if (!strcmp(argv[i], "-s"))
+			stats = true;
+		else if (!strcmp(argv[i], "-c") && i + 1 < argc) {
+			if (!parse_codecs(argv[++i]))
+				return 2;
+		} else if (!strcmp(argv[i], "-o") && i + 1 < argc)
+			prefix = argv[++i];
+		else
+			break;
+	}
+	if (i == argc) {
+		fprintf(stderr, "usage: sokpack [-v] [-s] [-c CODEC,...] "
+			"[-o PREFIX] FILE...\n");
+		return 2;
+	}
+
+	for (; i < argc; ++i)
+		read_levels(argv[i]);
+	if (n_errors) {
+		fprintf(stderr, "sokpack: %d invalid levels\n", n_errors);
+		return 1;
+	}
+	size_t n_dups = dedup();
+	if (n_levels == 0 || n_levels > UINT16_MAX
+		|| 4 + 4 * n_levels > LEVELPACK_MAX_SIZE) {
+		fprintf(stderr, "sokpack: %zu levels don't make a pack\n",
+			n_levels);
+		return 1;
+	}
+
+	size_t raw = 0, total = 0, n_codec[N_CODECS] = { 0 };
+	for (size_t j = 0; j < n_levels; ++j) {
+		encode(&levels[j]);
+		raw += BLOCK_HEADER_SIZE + levels[j].w * levels[j].h;
+		total += levels[j].block_size;
+		++n_codec[levels[j].block[0]];
+	}
+	int n_volumes = write_pack(prefix);
+
+	printf("%zu levels (%zu duplicates dropped) in %d volume%s: "
+		"%zu bytes, %zu uncompressed; codecs:", n_levels, n_dups,
+		n_volumes, n_volumes == 1 ? "" : "s", total, raw);
+	for (size_t c = 0; c < N_CODECS; ++c)
+		printf(" %s %zu", codecs[c].name, n_codec[c]);
+	printf("\n");
+
+	if (stats) {
+		printf("codec  alone      ratio\n");
+		for (size_t c = 0; c < N_CODECS; ++c) {
+			printf("%-6s %-10zu %.3f\n", codecs[c].name,
+				codec_total[c], (double) codec_total[c] / raw);
+		}
+	}
+	return 0;
+}